@@ -20,7 +20,31 @@ const float MIN_ZOOM_FACTOR = 0.02f;
 const float MAX_ZOOM_FACTOR = 2.0f;
 const float CAMERA_SCROLL_SPEED_TILES_PER_SEC = 150.0f;
 const float LOD_ACTIVATION_ZOOM_FACTOR = 0.10f;
-const int LOD_AGGREGATION_SCALE = 5;
+const int LOD_AGGREGATION_SCALE = 5;        // Target tiles per cell at the activation zoom
+// Averaged-colour pyramid levels (2x .. 16x); 16x is about the minimap's resolution.
+// LOD cells use power-of-two aggregation so each cell reads exactly one texel.
+const int LOD_PYRAMID_LEVELS = 4;
+// Changed cells closer than this are uploaded to the GPU as one range
+const int RENDERER_DIRTY_RUN_MERGE_GAP_CELLS = 32;
+// Reuse last frame's composed terrain cells when the camera pans by whole cells
+const bool RENDER_REUSE_SCROLLED_CELLS = true;
+
+// ===== FRAME PROFILER =====
+const int PROFILER_HISTORY_FRAMES = 120;
+const float PROFILER_GRAPH_PX_PER_MS = 4.0f;
+const float PROFILER_GRAPH_HEIGHT_PX = 160.0f;
+const std::string PROFILER_CSV_PATH = "frame_profile.csv";
+
+// ===== CAMERA-PATH BENCHMARK (--benchmark [seed]) =====
+const unsigned int BENCHMARK_WORLD_SEED = 1337;
+const float BENCHMARK_FRAME_STEP_SECONDS = 1.0f / 60.0f; // Path and animation time per frame
+const float BENCHMARK_LOD_ZOOM_FACTOR = 0.04f;           // Zoom-out target, well past LOD_ACTIVATION_ZOOM_FACTOR
+const int BENCHMARK_LAKE_SEARCH_BLOCK = 64;              // Block size (tiles) when looking for the largest lake
+const std::string BENCHMARK_CSV_PATH = "benchmark_profile.csv";
+
+// ===== PATTERN-GENERATION BENCHMARK (--benchmark-patterns [seed]) =====
+const int BENCHMARK_PATTERN_ROUNDS = 10;                 // Full variant sets generated per run
+const int BENCHMARK_NOISE_SAMPLES = 1 << 20;             // Calls per noise primitive timing
 
 // ===== MAP DIMENSIONS =====
 const int MAP_WIDTH = 5000;
@@ -67,6 +91,12 @@ const float Ks = 0.05f;
 const float Ke = 0.3f; 
 const float Kd = 0.01f;
 
+// Temporal blocking: run several erosion iterations per cache-sized tile (with a halo)
+// before writing back, instead of streaming the whole heightmap once per iteration.
+const bool EROSION_USE_TEMPORAL_TILING = true;
+const int EROSION_TILE_SIZE = 128;           // Interior tile edge in cells
+const int EROSION_TEMPORAL_DEPTH = 3;        // Iterations fused per tile pass
+
 // ===== BASIC UI COLORS =====
 namespace Colors {
     const sf::Color BLACK = sf::Color::Black;
@@ -0,0 +1,147 @@
+// File: EmergentKingdoms/src/Core/CameraPathBenchmark.cpp
+#include "CameraPathBenchmark.h"
+#include "BaseConfig.h"
+#include <iomanip>
+#include <algorithm>
+#include <cmath>
+
+namespace Core {
+
+CameraPathBenchmark::CameraPathBenchmark(const World::Map& map) :
+    current_segment(0),
+    segment_time_s(0.0f),
+    total_cells_composed(0)
+{
+    const float mid_x = static_cast<float>(MAP_WIDTH) / 2.0f;
+    const float mid_y = static_cast<float>(MAP_HEIGHT) / 2.0f;
+
+    // 1. Pan across the wrap seam at full detail
+    Segment seam_pan;
+    seam_pan.label = "seam pan";
+    seam_pan.from = CameraPose{static_cast<float>(MAP_WIDTH) - 200.0f, mid_y, 1.0f};
+    seam_pan.to = CameraPose{static_cast<float>(MAP_WIDTH) + 200.0f, mid_y, 1.0f};
+    seam_pan.duration_s = 6.0f;
+    segments.push_back(seam_pan);
+
+    // 2. Zoom out through the LOD threshold and back in (zoom is interpolated geometrically)
+    Segment zoom_out;
+    zoom_out.label = "LOD zoom out";
+    zoom_out.from = CameraPose{mid_x, mid_y, 1.0f};
+    zoom_out.to = CameraPose{mid_x, mid_y, BENCHMARK_LOD_ZOOM_FACTOR};
+    zoom_out.duration_s = 5.0f;
+    segments.push_back(zoom_out);
+
+    Segment zoom_in = zoom_out;
+    zoom_in.label = "LOD zoom in";
+    std::swap(zoom_in.from, zoom_in.to);
+    segments.push_back(zoom_in);
+
+    // 3. Hold over the largest lake, so nearly every visible cell is animated water
+    float lake_x = mid_x, lake_y = mid_y;
+    Segment lake_hover;
+    lake_hover.label = findLargestLake(map, lake_x, lake_y) ? "lake hover" : "lake hover (no lake: map centre)";
+    lake_hover.from = CameraPose{lake_x, lake_y, 1.0f};
+    lake_hover.to = lake_hover.from;
+    lake_hover.duration_s = 6.0f;
+    segments.push_back(lake_hover);
+}
+
+bool CameraPathBenchmark::findLargestLake(const World::Map& map, float& centre_x, float& centre_y) {
+    // Count lake tiles per coarse block and take the centroid of the fullest block
+    const int block = BENCHMARK_LAKE_SEARCH_BLOCK;
+    const int blocks_x = (MAP_WIDTH + block - 1) / block;
+    const int blocks_y = (MAP_HEIGHT + block - 1) / block;
+    std::vector<int> lake_count(static_cast<size_t>(blocks_x) * blocks_y, 0);
+    std::vector<double> sum_x(lake_count.size(), 0.0);
+    std::vector<double> sum_y(lake_count.size(), 0.0);
+
+    for (int y = 0; y < MAP_HEIGHT; ++y) {
+        for (int x = 0; x < MAP_WIDTH; ++x) {
+            if (map.getTile(x, y).base_type != World::BaseTileType::LAKE_WATER) continue;
+            size_t index = static_cast<size_t>(y / block) * blocks_x + (x / block);
+            ++lake_count[index];
+            sum_x[index] += x;
+            sum_y[index] += y;
+        }
+    }
+
+    auto fullest = std::max_element(lake_count.begin(), lake_count.end());
+    if (fullest == lake_count.end() || *fullest == 0) return false;
+    size_t index = static_cast<size_t>(fullest - lake_count.begin());
+    centre_x = static_cast<float>(sum_x[index] / *fullest);
+    centre_y = static_cast<float>(sum_y[index] / *fullest);
+    return true;
+}
+
+CameraPose CameraPathBenchmark::currentPose() const {
+    if (isFinished()) return segments.back().to;
+    const Segment& segment = segments[current_segment];
+    float t = std::min(1.0f, segment_time_s / segment.duration_s);
+    CameraPose pose;
+    pose.centre_x = segment.from.centre_x + (segment.to.centre_x - segment.from.centre_x) * t;
+    pose.centre_y = segment.from.centre_y + (segment.to.centre_y - segment.from.centre_y) * t;
+    pose.zoom = segment.from.zoom * std::pow(segment.to.zoom / segment.from.zoom, t);
+    return pose;
+}
+
+void CameraPathBenchmark::recordFrame(const FrameProfiler::StageTimes& stage_times, sf::Time wall_time, size_t cells_composed) {
+    if (isFinished()) return;
+    frame_stage_times.push_back(stage_times);
+    frame_wall_ms.push_back(wall_time.asMicroseconds() / 1000.0f);
+    total_cells_composed += cells_composed;
+    ++segments[current_segment].frames;
+    segments[current_segment].wall_seconds += wall_time.asSeconds();
+}
+
+void CameraPathBenchmark::advance() {
+    if (isFinished()) return;
+    segment_time_s += BENCHMARK_FRAME_STEP_SECONDS;
+    if (segment_time_s >= segments[current_segment].duration_s) {
+        segment_time_s = 0.0f;
+        ++current_segment;
+    }
+}
+
+void CameraPathBenchmark::printReport(std::ostream& out, unsigned int world_seed) const {
+    double total_seconds = 0.0;
+    for (const Segment& segment : segments) total_seconds += segment.wall_seconds;
+    size_t total_frames = frame_wall_ms.size();
+
+    out << "===== CAMERA-PATH BENCHMARK (seed " << world_seed << ") =====" << std::endl;
+    if (!isFinished()) {
+        out << "Aborted before the end of the path; partial results." << std::endl;
+    }
+    out << std::fixed << std::setprecision(2);
+    out << "Frames: " << total_frames << " in " << total_seconds << " s";
+    if (total_seconds > 0.0) {
+        out << " -> " << total_frames / total_seconds << " fps, "
+            << static_cast<unsigned long long>(total_cells_composed / total_seconds) << " cells composed/s";
+    }
+    out << std::endl;
+
+    out << std::left << std::setw(34) << "segment" << std::right << std::setw(8) << "frames" << std::setw(10) << "fps" << std::endl;
+    for (const Segment& segment : segments) {
+        out << std::left << std::setw(34) << segment.label << std::right << std::setw(8) << segment.frames
+            << std::setw(10) << (segment.wall_seconds > 0.0 ? segment.frames / segment.wall_seconds : 0.0) << std::endl;
+    }
+
+    out << std::left << std::setw(10) << "ms" << std::right
+        << std::setw(8) << "p50" << std::setw(8) << "p95" << std::setw(8) << "p99" << std::endl;
+    std::vector<float> samples;
+    samples.reserve(total_frames);
+    auto printRow = [&out](const std::string& name, std::vector<float>& values) {
+        out << std::left << std::setw(10) << name << std::right
+            << std::setw(8) << FrameProfiler::percentile(values, 0.50f)
+            << std::setw(8) << FrameProfiler::percentile(values, 0.95f)
+            << std::setw(8) << FrameProfiler::percentile(values, 0.99f) << std::endl;
+    };
+    for (size_t stage = 0; stage < FRAME_STAGE_COUNT; ++stage) {
+        samples.clear();
+        for (const auto& frame : frame_stage_times) samples.push_back(frame[stage]);
+        printRow(FrameProfiler::stageName(static_cast<FrameStage>(stage)), samples);
+    }
+    samples = frame_wall_ms;
+    printRow("frame", samples);
+}
+
+} // namespace Core
@@ -0,0 +1,63 @@
+// File: EmergentKingdoms/src/Core/CameraPathBenchmark.h
+#pragma once
+
+#include <vector>
+#include <string>
+#include <ostream>
+#include <SFML/System.hpp>
+#include "FrameProfiler.h"
+#include "../World/Map.h"
+
+namespace Core {
+
+// Where the camera looks (view centre in map tiles) and at what zoom
+struct CameraPose {
+    float centre_x = 0.0f; // May run past MAP_WIDTH; the caller wraps it
+    float centre_y = 0.0f;
+    float zoom = 1.0f;
+};
+
+/**
+ * Scripted camera path for repeatable render measurements: a pan across the
+ * X wrap seam, a zoom out through the LOD threshold and back, and a hover
+ * over the largest lake. Path time advances by BENCHMARK_FRAME_STEP_SECONDS
+ * per frame. Game::runBenchmark never starts the simulation thread and sets
+ * the animation time from the frame index, so every run renders the same
+ * sequence of frames; only the wall time they take differs. The minimap
+ * builds in the background and may finish on a different frame.
+ */
+class CameraPathBenchmark {
+public:
+    explicit CameraPathBenchmark(const World::Map& map);
+
+    bool isFinished() const { return current_segment >= segments.size(); }
+    CameraPose currentPose() const;
+
+    // Record the frame just rendered at currentPose(), then move along the path
+    void recordFrame(const FrameProfiler::StageTimes& stage_times, sf::Time wall_time, size_t cells_composed);
+    void advance();
+
+    void printReport(std::ostream& out, unsigned int world_seed) const;
+
+private:
+    struct Segment {
+        std::string label;
+        CameraPose from;
+        CameraPose to;
+        float duration_s;
+        size_t frames = 0;
+        double wall_seconds = 0.0;
+    };
+
+    std::vector<Segment> segments;
+    size_t current_segment;
+    float segment_time_s;
+
+    std::vector<FrameProfiler::StageTimes> frame_stage_times;
+    std::vector<float> frame_wall_ms;
+    unsigned long long total_cells_composed;
+
+    static bool findLargestLake(const World::Map& map, float& centre_x, float& centre_y);
+};
+
+} // namespace Core
@@ -0,0 +1,207 @@
+// File: EmergentKingdoms/src/Core/FrameProfiler.cpp
+#include "FrameProfiler.h"
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <algorithm>
+#include <cmath>
+
+namespace Core {
+
+namespace {
+
+// Stacked graph colour per stage, in FrameStage order
+const sf::Color STAGE_COLORS[FRAME_STAGE_COUNT] = {
+    sf::Color(120, 120, 120),  // EVENTS
+    sf::Color(90, 140, 200),   // INPUT
+    sf::Color(200, 170, 60),   // UPDATE
+    sf::Color(220, 90, 60),    // COMPOSE
+    sf::Color(200, 80, 180),   // VERTICES
+    sf::Color(80, 190, 110),   // DRAW
+    sf::Color(90, 200, 200),   // MINIMAP
+    sf::Color(230, 230, 230)   // DISPLAY
+};
+
+} // anonymous namespace
+
+FrameProfiler::FrameProfiler() :
+    history(static_cast<size_t>(PROFILER_HISTORY_FRAMES)),
+    history_next(0),
+    history_count(0),
+    frame_index(0)
+{
+    current_frame.fill(0.0f);
+    last_frame.fill(0.0f);
+}
+
+FrameProfiler::~FrameProfiler() {
+    stopCsv();
+}
+
+const char* FrameProfiler::stageName(FrameStage stage) {
+    switch (stage) {
+        case FrameStage::EVENTS:   return "events";
+        case FrameStage::INPUT:    return "input";
+        case FrameStage::UPDATE:   return "update";
+        case FrameStage::COMPOSE:  return "compose";
+        case FrameStage::VERTICES: return "vertices";
+        case FrameStage::DRAW:     return "draw";
+        case FrameStage::MINIMAP:  return "minimap";
+        case FrameStage::DISPLAY:  return "display";
+        default:                   return "?";
+    }
+}
+
+void FrameProfiler::addStageTime(FrameStage stage, sf::Time elapsed) {
+    current_frame[static_cast<size_t>(stage)] += elapsed.asMicroseconds() / 1000.0f;
+}
+
+void FrameProfiler::endFrame() {
+    if (csv_file.is_open()) {
+        float total_ms = 0.0f;
+        csv_file << frame_index;
+        for (float stage_ms : current_frame) {
+            csv_file << "," << stage_ms;
+            total_ms += stage_ms;
+        }
+        csv_file << "," << total_ms << "\n";
+    }
+
+    last_frame = current_frame;
+    history[history_next] = current_frame;
+    history_next = (history_next + 1) % history.size();
+    history_count = std::min(history_count + 1, history.size());
+    current_frame.fill(0.0f);
+    ++frame_index;
+}
+
+bool FrameProfiler::startCsv(const std::string& path) {
+    stopCsv();
+    csv_file.open(path, std::ios::out | std::ios::trunc);
+    if (!csv_file.is_open()) {
+        std::cerr << "FrameProfiler::startCsv() - ERROR: Could not open " << path << std::endl;
+        return false;
+    }
+    csv_file << "frame";
+    for (size_t stage = 0; stage < FRAME_STAGE_COUNT; ++stage) {
+        csv_file << "," << stageName(static_cast<FrameStage>(stage)) << "_ms";
+    }
+    csv_file << ",total_ms\n";
+    std::cout << "Frame profiler: streaming samples to " << path << std::endl;
+    return true;
+}
+
+void FrameProfiler::stopCsv() {
+    if (csv_file.is_open()) {
+        csv_file.close();
+        std::cout << "Frame profiler: CSV stream closed." << std::endl;
+    }
+}
+
+const FrameProfiler::StageTimes& FrameProfiler::historyAt(size_t age) const {
+    size_t oldest = (history_next + history.size() - history_count) % history.size();
+    return history[(oldest + age) % history.size()];
+}
+
+float FrameProfiler::percentile(std::vector<float>& values, float fraction) {
+    if (values.empty()) return 0.0f;
+    size_t rank = static_cast<size_t>(std::ceil(fraction * values.size()));
+    size_t index = std::min(values.size() - 1, rank > 0 ? rank - 1 : 0);
+    std::nth_element(values.begin(), values.begin() + index, values.end());
+    return values[index];
+}
+
+void FrameProfiler::draw(sf::RenderTarget& target, const sf::Font& font) const {
+    const float margin = 10.0f;
+    const float bar_width = 3.0f;
+    const unsigned int text_size = 14;
+    const float line_height = 17.0f;
+    const float graph_width = bar_width * PROFILER_HISTORY_FRAMES;
+    const float panel_width = graph_width + 2.0f * margin;
+    const float text_block_height = line_height * (FRAME_STAGE_COUNT + 3);
+    const float panel_height = PROFILER_GRAPH_HEIGHT_PX + text_block_height + 3.0f * margin;
+    const float panel_left = margin;
+    const float panel_top = static_cast<float>(WINDOW_HEIGHT_PX) - panel_height - margin;
+
+    sf::RectangleShape panel(sf::Vector2f(panel_width, panel_height));
+    panel.setPosition(panel_left, panel_top);
+    panel.setFillColor(sf::Color(0, 0, 0, 190));
+    panel.setOutlineColor(sf::Color(150, 150, 150, 200));
+    panel.setOutlineThickness(1.0f);
+    target.draw(panel);
+
+    // ===== ROLLING STACKED GRAPH (newest frame on the right) =====
+    float graph_left = panel_left + margin;
+    float graph_bottom = panel_top + margin + PROFILER_GRAPH_HEIGHT_PX;
+    sf::VertexArray bars(sf::Quads);
+    for (size_t age = 0; age < history_count; ++age) {
+        const StageTimes& frame = historyAt(age);
+        float bar_left = graph_left + graph_width - bar_width * (history_count - age);
+        float stack_bottom = graph_bottom;
+        for (size_t stage = 0; stage < FRAME_STAGE_COUNT && stack_bottom > graph_bottom - PROFILER_GRAPH_HEIGHT_PX; ++stage) {
+            float stack_top = std::max(graph_bottom - PROFILER_GRAPH_HEIGHT_PX,
+                                       stack_bottom - frame[stage] * PROFILER_GRAPH_PX_PER_MS);
+            if (stack_top >= stack_bottom) continue;
+            const sf::Color& color = STAGE_COLORS[stage];
+            bars.append(sf::Vertex(sf::Vector2f(bar_left, stack_top), color));
+            bars.append(sf::Vertex(sf::Vector2f(bar_left + bar_width - 1.0f, stack_top), color));
+            bars.append(sf::Vertex(sf::Vector2f(bar_left + bar_width - 1.0f, stack_bottom), color));
+            bars.append(sf::Vertex(sf::Vector2f(bar_left, stack_bottom), color));
+            stack_bottom = stack_top;
+        }
+    }
+    // 60 fps budget line
+    float budget_y = graph_bottom - (1000.0f / 60.0f) * PROFILER_GRAPH_PX_PER_MS;
+    if (budget_y > graph_bottom - PROFILER_GRAPH_HEIGHT_PX) {
+        sf::Color budget_color(255, 255, 255, 120);
+        bars.append(sf::Vertex(sf::Vector2f(graph_left, budget_y), budget_color));
+        bars.append(sf::Vertex(sf::Vector2f(graph_left + graph_width, budget_y), budget_color));
+        bars.append(sf::Vertex(sf::Vector2f(graph_left + graph_width, budget_y + 1.0f), budget_color));
+        bars.append(sf::Vertex(sf::Vector2f(graph_left, budget_y + 1.0f), budget_color));
+    }
+    target.draw(bars);
+
+    // ===== PERCENTILE TABLE =====
+    std::vector<float> samples;
+    samples.reserve(history_count);
+    std::vector<float> totals;
+    totals.reserve(history_count);
+    for (size_t age = 0; age < history_count; ++age) {
+        const StageTimes& frame = historyAt(age);
+        float total = 0.0f;
+        for (float stage_ms : frame) total += stage_ms;
+        totals.push_back(total);
+    }
+
+    float text_left = graph_left;
+    float text_top = graph_bottom + margin;
+    auto drawLine = [&](const std::string& line, const sf::Color& color, int row) {
+        sf::Text text(line, font, text_size);
+        text.setFillColor(color);
+        text.setPosition(text_left, text_top + line_height * row);
+        target.draw(text);
+    };
+    auto formatRow = [](const std::string& name, std::vector<float>& values) {
+        std::ostringstream row;
+        row << std::left << std::setw(10) << name << std::right << std::fixed << std::setprecision(2)
+            << std::setw(8) << percentile(values, 0.50f)
+            << std::setw(8) << percentile(values, 0.95f)
+            << std::setw(8) << percentile(values, 0.99f);
+        return row.str();
+    };
+
+    std::ostringstream header;
+    header << std::left << std::setw(10) << "ms" << std::right
+           << std::setw(8) << "p50" << std::setw(8) << "p95" << std::setw(8) << "p99";
+    drawLine(header.str(), sf::Color::White, 0);
+    for (size_t stage = 0; stage < FRAME_STAGE_COUNT; ++stage) {
+        samples.clear();
+        for (size_t age = 0; age < history_count; ++age) samples.push_back(historyAt(age)[stage]);
+        drawLine(formatRow(stageName(static_cast<FrameStage>(stage)), samples), STAGE_COLORS[stage], static_cast<int>(stage) + 1);
+    }
+    drawLine(formatRow("total", totals), sf::Color::White, static_cast<int>(FRAME_STAGE_COUNT) + 1);
+    drawLine(csv_file.is_open() ? "CSV: recording (Shift+P to stop)" : "CSV: off (Shift+P to record)",
+             sf::Color(180, 180, 180), static_cast<int>(FRAME_STAGE_COUNT) + 2);
+}
+
+} // namespace Core
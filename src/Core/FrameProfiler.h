@@ -0,0 +1,68 @@
+// File: EmergentKingdoms/src/Core/FrameProfiler.h
+#pragma once
+
+#include <array>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <SFML/Graphics.hpp>
+#include "BaseConfig.h"
+
+namespace Core {
+
+// Timed sections of one main-loop iteration, in loop order
+enum class FrameStage {
+    EVENTS,    // window.pollEvent / handleEvent
+    INPUT,     // processContinuousInput
+    UPDATE,    // Taking in the latest simulation snapshot (ticks run on their own thread)
+    COMPOSE,   // Cell composition in Game::render
+    VERTICES,  // Renderer vertex slot building and upload
+    DRAW,      // window.draw of the cell grid
+    MINIMAP,   // Minimap upload and overlay draw
+    DISPLAY,   // window.display (includes waiting on the driver / vsync)
+    COUNT
+};
+
+constexpr size_t FRAME_STAGE_COUNT = static_cast<size_t>(FrameStage::COUNT);
+
+/**
+ * Per-frame stage timings: a rolling history for the overlay (stacked graph
+ * plus p50/p95/p99 per stage) and an optional CSV stream with one row per frame.
+ */
+class FrameProfiler {
+public:
+    FrameProfiler();
+    ~FrameProfiler();
+
+    // Time is accumulated, so a stage may be reported several times per frame
+    void addStageTime(FrameStage stage, sf::Time elapsed);
+    // Close the current frame: push it into the history and the CSV stream
+    void endFrame();
+
+    bool startCsv(const std::string& path);
+    void stopCsv();
+    bool isCsvActive() const { return csv_file.is_open(); }
+
+    void draw(sf::RenderTarget& target, const sf::Font& font) const;
+
+    using StageTimes = std::array<float, FRAME_STAGE_COUNT>; // Milliseconds
+    // Stage times of the most recently closed frame
+    const StageTimes& lastFrame() const { return last_frame; }
+
+    static const char* stageName(FrameStage stage);
+    // Nearest-rank percentile; reorders values
+    static float percentile(std::vector<float>& values, float fraction);
+
+private:
+    StageTimes current_frame;
+    StageTimes last_frame;
+    std::vector<StageTimes> history; // Ring buffer of PROFILER_HISTORY_FRAMES frames
+    size_t history_next;
+    size_t history_count;
+    unsigned long long frame_index;
+    std::ofstream csv_file;
+
+    const StageTimes& historyAt(size_t age) const; // age 0 = oldest retained frame
+};
+
+} // namespace Core
@@ -10,16 +10,25 @@
 #include <ctime>
 #include <algorithm>
 #include <cmath> 
+#include <omp.h>
 
 namespace Core {
 
 Game::Game() :
-    window(sf::VideoMode(WINDOW_WIDTH_PX, WINDOW_HEIGHT_PX), "Emergent Kingdoms", sf::Style::Default),
-    game_map(MAP_WIDTH, MAP_HEIGHT, static_cast<unsigned int>(std::time(nullptr))),
-    minimap_texture_needs_update(true),
-    show_minimap(true),
+    Game(static_cast<unsigned int>(std::time(nullptr)))
+{
+}
+
+Game::Game(unsigned int seed, bool headless_mode) :
+    world_seed(seed),
+    headless(headless_mode),
+    render_backend(nullptr),
+    game_map(MAP_WIDTH, MAP_HEIGHT, seed),
+    show_minimap(!headless_mode),
+    show_profiler(false),
     current_zoom_factor(1.0f),
     m_current_lod_scale(1),
+    m_current_lod_level(0),
     camera_x(0.0f),
     camera_y(0.0f),
     render_pixel_offset_x(0.0f),
@@ -30,11 +39,22 @@ Game::Game() :
     wave_flow_offset(0.0f),
     secondary_wave_offset(0.0f),
     tertiary_wave_offset(0.0f),
-    prev_wave_time(0.0f)
+    prev_wave_time(0.0f),
+    composed_origin_cell_x(0),
+    composed_origin_cell_y(0),
+    composed_cols(0),
+    composed_rows(0),
+    composed_lod_scale(0),
+    composed_cells_valid(false),
+    cells_composed_last_frame(0),
+    simulation_tick(0)
 {
-    srand(static_cast<unsigned int>(std::time(nullptr)));
-    window.setFramerateLimit(0); 
-    window.setVerticalSyncEnabled(true);
+    srand(world_seed);
+    if (!headless) {
+        window.create(sf::VideoMode(WINDOW_WIDTH_PX, WINDOW_HEIGHT_PX), "Emergent Kingdoms", sf::Style::Default);
+        window.setFramerateLimit(0); 
+        window.setVerticalSyncEnabled(true);
+    }
     
     // Initialize masterpiece wave timing
     master_wave_clock.restart();
@@ -46,14 +66,19 @@ Game::~Game() {
 
 bool Game::initialize() { 
     updateZoom(1.0f); 
-    if (!game_renderer.initialize(window, current_sfml_font_size)) {
+    // Headless: same cell grid, rasterised on the CPU into a window-sized image
+    bool backend_ready = headless
+        ? software_renderer.initialize(WINDOW_WIDTH_PX, WINDOW_HEIGHT_PX, current_sfml_font_size)
+        : game_renderer.initialize(window, current_sfml_font_size);
+    if (!backend_ready) {
         std::cerr << "Game::initialize(): Renderer failed to initialize!" << std::endl;
         return false;
     }
-    game_renderer.updateLayout(current_sfml_font_size,
-                               current_char_cell_width_px, current_char_cell_height_px,
-                               current_screen_width_chars, current_screen_height_chars);
-    if (!initializeMinimapOverlay()) {
+    render_backend = headless ? static_cast<IRenderBackend*>(&software_renderer) : &game_renderer;
+    render_backend->updateLayout(current_sfml_font_size,
+                                 current_char_cell_width_px, current_char_cell_height_px,
+                                 current_screen_width_chars, current_screen_height_chars);
+    if (!headless && !initializeMinimapOverlay()) {
          std::cerr << "Game::initialize(): Minimap Overlay failed to initialize!" << std::endl;
     }
     
@@ -61,6 +86,10 @@ bool Game::initialize() {
     std::cout << "Starting world generation..." << std::endl;
     game_map.generate();
     std::cout << "World generation completed." << std::endl;
+    wind_field.initialize(MAP_WIDTH, MAP_HEIGHT, world_seed);
+    if (!headless) {
+        minimap_builder.start(game_map, minimap_texture.getSize().x, minimap_texture.getSize().y);
+    }
     
     float initial_effective_screen_width_map_tiles = static_cast<float>(current_screen_width_chars * m_current_lod_scale);
     float initial_effective_screen_height_map_tiles = static_cast<float>(current_screen_height_chars * m_current_lod_scale);
@@ -72,19 +101,26 @@ bool Game::initialize() {
     camera_y = std::max(0.0f, std::min(camera_y, max_camera_y_tiles));
     entities.push_back(std::make_unique<Entities::Fartling>(MAP_WIDTH / 2, MAP_HEIGHT / 2));
     entities.push_back(std::make_unique<Entities::Fartling>(MAP_WIDTH / 3, MAP_HEIGHT / 3));
+
+    publishSnapshot();
+    consumeSnapshot();
     delta_clock.restart(); 
     return true;
 }
 
 bool Game::initializeMinimapOverlay() { 
-    if (!minimap_texture.create(MAP_WIDTH, MAP_HEIGHT)) {
+    float minimap_w = static_cast<float>(WINDOW_WIDTH_PX) * MINIMAP_OVERLAY_WIDTH_FACTOR;
+    float minimap_h = static_cast<float>(WINDOW_HEIGHT_PX) * MINIMAP_OVERLAY_HEIGHT_FACTOR;
+    // Texture at the overlay's own resolution rather than one texel per tile
+    unsigned int minimap_texture_w = static_cast<unsigned int>(std::ceil(minimap_w));
+    unsigned int minimap_texture_h = static_cast<unsigned int>(std::ceil(minimap_h));
+    if (!minimap_texture.create(minimap_texture_w, minimap_texture_h)) {
         std::cerr << "Error creating minimap texture!" << std::endl; 
         return false;
     }
     minimap_sprite.setTexture(minimap_texture);
-    float minimap_w = static_cast<float>(WINDOW_WIDTH_PX) * MINIMAP_OVERLAY_WIDTH_FACTOR;
-    float minimap_h = static_cast<float>(WINDOW_HEIGHT_PX) * MINIMAP_OVERLAY_HEIGHT_FACTOR;
-    minimap_sprite.setScale( minimap_w / MAP_WIDTH, minimap_h / MAP_HEIGHT );
+    minimap_sprite.setScale(minimap_w / minimap_texture_w, minimap_h / minimap_texture_h);
+    minimap_tiles_to_px = sf::Vector2f(minimap_w / MAP_WIDTH, minimap_h / MAP_HEIGHT);
     minimap_sprite.setPosition(WINDOW_WIDTH_PX - minimap_w - MINIMAP_MARGIN_PX, MINIMAP_MARGIN_PX);
     minimap_background_rect.setSize(sf::Vector2f(minimap_w, minimap_h));
     minimap_background_rect.setPosition(minimap_sprite.getPosition());
@@ -94,15 +130,22 @@ bool Game::initializeMinimapOverlay() {
     minimap_viewport_rect.setFillColor(sf::Color(255, 255, 255, 70));
     minimap_viewport_rect.setOutlineColor(sf::Color::White);
     minimap_viewport_rect.setOutlineThickness(1.0f); 
-    minimap_texture_needs_update = true;
     return true;
 }
 
 void Game::updateZoom(float new_zoom_factor) { 
     current_zoom_factor = std::max(MIN_ZOOM_FACTOR, std::min(MAX_ZOOM_FACTOR, new_zoom_factor));
     m_current_lod_scale = 1;
+    m_current_lod_level = 0;
     if (current_zoom_factor < LOD_ACTIVATION_ZOOM_FACTOR) {
-        m_current_lod_scale = LOD_AGGREGATION_SCALE;
+        // Power-of-two scale (one pyramid texel per cell) keeping cells near their activation size
+        float wanted_lod_scale = LOD_AGGREGATION_SCALE * LOD_ACTIVATION_ZOOM_FACTOR / current_zoom_factor;
+        m_current_lod_scale = 2;
+        m_current_lod_level = 1;
+        while (m_current_lod_scale < wanted_lod_scale && m_current_lod_level < LOD_PYRAMID_LEVELS) {
+            m_current_lod_scale *= 2;
+            ++m_current_lod_level;
+        }
     }
     float visual_tile_width_px = INITIAL_CHAR_CELL_WIDTH_PX * current_zoom_factor;
     float visual_tile_height_px = INITIAL_CHAR_CELL_HEIGHT_PX * current_zoom_factor;
@@ -122,8 +165,8 @@ void Game::updateZoom(float new_zoom_factor) {
         current_screen_height_chars = WINDOW_HEIGHT_PX;
     } 
     current_screen_height_chars = std::max(1, current_screen_height_chars);
-    if (game_renderer.isInitialized()) {
-         game_renderer.updateLayout(current_sfml_font_size,
+    if (render_backend != nullptr && render_backend->isInitialized()) {
+         render_backend->updateLayout(current_sfml_font_size,
                                    current_char_cell_width_px, current_char_cell_height_px,
                                    current_screen_width_chars, current_screen_height_chars);
     }
@@ -134,29 +177,144 @@ void Game::updateZoom(float new_zoom_factor) {
 }
 
 void Game::run() { 
+    if (headless) {
+        std::cerr << "Game::run(): the interactive loop needs a window; use runBenchmark or runScreenshot" << std::endl;
+        return;
+    }
     if (!initialize()) {
         std::cerr << "Game::run(): Game failed to initialize!" << std::endl;
         return;
     }
-    sf::Time time_since_last_update = sf::Time::Zero;
+    // From here on, entities and the wave state belong to the simulation thread;
+    // the render thread only reads published snapshots
+    simulation_thread.start([this](sf::Time tick_length) { update(tick_length); },
+                            sf::microseconds(MS_PER_TICK * 1000));
     sf::Time frame_delta_time_for_input; 
+    sf::Clock stage_clock;
     while (window.isOpen()) {
         sf::Time frame_delta_time = delta_clock.restart();
-        time_since_last_update += frame_delta_time;
         frame_delta_time_for_input = frame_delta_time;
+        stage_clock.restart();
         sf::Event event;
         while (window.pollEvent(event)) {
             handleEvent(event);
         }
+        frame_profiler.addStageTime(FrameStage::EVENTS, stage_clock.restart());
         processContinuousInput(frame_delta_time_for_input); 
-        while (time_since_last_update.asMicroseconds() >= MS_PER_TICK * 1000) {
-             time_since_last_update -= sf::microseconds(MS_PER_TICK * 1000);
-             update(sf::microseconds(MS_PER_TICK * 1000)); 
-        }
+        frame_profiler.addStageTime(FrameStage::INPUT, stage_clock.restart());
+        // Ticks run on the simulation thread; here we only take in its latest snapshot
+        consumeSnapshot();
+        frame_profiler.addStageTime(FrameStage::UPDATE, stage_clock.restart());
         if (!window.isOpen()) break; 
         render();
+        frame_profiler.endFrame();
     }
-    game_renderer.shutdown(); 
+    simulation_thread.stop();
+    render_backend->shutdown(); 
+}
+
+void Game::runBenchmark() {
+    if (!initialize()) {
+        std::cerr << "Game::runBenchmark(): Game failed to initialize!" << std::endl;
+        return;
+    }
+    if (!headless) {
+        window.setVerticalSyncEnabled(false); // Measure the frame work, not the display refresh
+    }
+
+    // No simulation thread: entities stay where initialize() put them and the animation
+    // clock follows the frame index, so every run renders the same frames
+    unsigned long long benchmark_frame = 0;
+
+    CameraPathBenchmark benchmark(game_map);
+    frame_profiler.startCsv(BENCHMARK_CSV_PATH);
+    if (headless) {
+        std::cout << "Running camera-path benchmark headless (software renderer)..." << std::endl;
+    } else {
+        std::cout << "Running camera-path benchmark (close the window or press Escape to abort)..." << std::endl;
+    }
+
+    sf::Clock frame_clock;
+    sf::Clock stage_clock;
+    while ((headless || window.isOpen()) && !benchmark.isFinished()) {
+        frame_clock.restart();
+        stage_clock.restart();
+        sf::Event event;
+        while (!headless && window.pollEvent(event)) {
+            if (event.type == sf::Event::Closed ||
+                (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Escape)) {
+                window.close();
+            }
+        }
+        frame_profiler.addStageTime(FrameStage::EVENTS, stage_clock.restart());
+        if (!headless && !window.isOpen()) break;
+
+        // The scripted pose stands in for player input
+        CameraPose pose = benchmark.currentPose();
+        if (pose.zoom != current_zoom_factor) {
+            updateZoom(pose.zoom);
+        }
+        centerCameraOn(pose.centre_x, pose.centre_y);
+        frame_profiler.addStageTime(FrameStage::INPUT, stage_clock.restart());
+        freezeAnimationAt(static_cast<float>(benchmark_frame) * BENCHMARK_FRAME_STEP_SECONDS);
+        frame_profiler.addStageTime(FrameStage::UPDATE, stage_clock.restart());
+        render();
+        frame_profiler.endFrame();
+
+        benchmark.recordFrame(frame_profiler.lastFrame(), frame_clock.getElapsedTime(), cells_composed_last_frame);
+        benchmark.advance();
+        ++benchmark_frame;
+    }
+    frame_profiler.stopCsv();
+    benchmark.printReport(std::cout, world_seed);
+    render_backend->shutdown();
+}
+
+bool Game::runScreenshot(const std::string& output_path) {
+    if (!headless) {
+        std::cerr << "Game::runScreenshot(): needs a headless Game" << std::endl;
+        return false;
+    }
+    if (!initialize()) {
+        std::cerr << "Game::runScreenshot(): Game failed to initialize!" << std::endl;
+        return false;
+    }
+    std::cout << "===== HEADLESS SCREENSHOT (seed " << world_seed << ") =====" << std::endl;
+
+    // The map centre at full zoom with animation at time zero, through the same render() as the window
+    centerCameraOn(MAP_WIDTH / 2.0f, MAP_HEIGHT / 2.0f);
+    freezeAnimationAt(0.0f);
+    sf::Clock render_clock;
+    render();
+    double render_ms = render_clock.getElapsedTime().asMicroseconds() / 1000.0;
+
+    bool saved = software_renderer.saveToFile(output_path);
+    if (saved) {
+        std::cout << "Rendered " << composed_cols << "x" << composed_rows << " cells ("
+                  << software_renderer.getWidthPx() << "x" << software_renderer.getHeightPx() << " px) in "
+                  << render_ms << " ms, written to " << output_path << std::endl;
+    }
+    render_backend->shutdown();
+    return saved;
+}
+
+void Game::freezeAnimationAt(float animation_time_seconds) {
+    // Stands in for a simulation tick: wave state from a fixed time, entities unchanged
+    master_wave_time = animation_time_seconds;
+    updateWavePhases();
+    publishSnapshot();
+    consumeSnapshot();
+}
+
+void Game::centerCameraOn(float map_x_tiles, float map_y_tiles) {
+    float effective_screen_width_map_tiles = static_cast<float>(current_screen_width_chars * m_current_lod_scale);
+    float effective_screen_height_map_tiles = static_cast<float>(current_screen_height_chars * m_current_lod_scale);
+    camera_x = map_x_tiles - (effective_screen_width_map_tiles / 2.0f);
+    camera_y = map_y_tiles - (effective_screen_height_map_tiles / 2.0f);
+    camera_x = std::fmod(std::fmod(camera_x, static_cast<float>(MAP_WIDTH)) + static_cast<float>(MAP_WIDTH), static_cast<float>(MAP_WIDTH));
+    float max_camera_y_tiles = static_cast<float>(MAP_HEIGHT) - effective_screen_height_map_tiles;
+    if (max_camera_y_tiles < 0) max_camera_y_tiles = 0;
+    camera_y = std::max(0.0f, std::min(camera_y, max_camera_y_tiles));
 }
 
 void Game::handleEvent(sf::Event& event) { 
@@ -178,6 +336,14 @@ void Game::handleEvent(sf::Event& event) {
         if (event.key.code == sf::Keyboard::M) {
             show_minimap = !show_minimap;
         }
+        if (event.key.code == sf::Keyboard::P) {
+            if (event.key.shift) {
+                if (frame_profiler.isCsvActive()) frame_profiler.stopCsv();
+                else frame_profiler.startCsv(PROFILER_CSV_PATH);
+            } else {
+                show_profiler = !show_profiler;
+            }
+        }
     }
     if (event.type == sf::Event::MouseWheelScrolled) {
         if (event.mouseWheelScroll.wheel == sf::Mouse::VerticalWheel) {
@@ -191,20 +357,13 @@ void Game::handleEvent(sf::Event& event) {
                 sf::Vector2i mouse_pos_window = sf::Mouse::getPosition(window);
                 if (minimap_background_rect.getGlobalBounds().contains(static_cast<sf::Vector2f>(mouse_pos_window))) {
                     sf::Vector2f minimap_sprite_pos = minimap_sprite.getPosition();
-                    sf::Vector2f minimap_sprite_scale = minimap_sprite.getScale();
+                    sf::Vector2f minimap_sprite_scale = minimap_tiles_to_px;
                     if (minimap_sprite_scale.x == 0.0f || minimap_sprite_scale.y == 0.0f) return; 
                     float click_relative_x_px = static_cast<float>(mouse_pos_window.x) - minimap_sprite_pos.x;
                     float click_relative_y_px = static_cast<float>(mouse_pos_window.y) - minimap_sprite_pos.y;
                     float target_map_x_tiles = click_relative_x_px / minimap_sprite_scale.x;
                     float target_map_y_tiles = click_relative_y_px / minimap_sprite_scale.y;
-                    float effective_screen_width_map_tiles = static_cast<float>(current_screen_width_chars * m_current_lod_scale);
-                    float effective_screen_height_map_tiles = static_cast<float>(current_screen_height_chars * m_current_lod_scale);
-                    camera_x = target_map_x_tiles - (effective_screen_width_map_tiles / 2.0f);
-                    camera_y = target_map_y_tiles - (effective_screen_height_map_tiles / 2.0f);
-                    camera_x = std::fmod(std::fmod(camera_x, static_cast<float>(MAP_WIDTH)) + static_cast<float>(MAP_WIDTH), static_cast<float>(MAP_WIDTH));
-                    float max_camera_y_tiles = static_cast<float>(MAP_HEIGHT) - effective_screen_height_map_tiles;
-                     if (max_camera_y_tiles < 0) max_camera_y_tiles = 0;
-                    camera_y = std::max(0.0f, std::min(camera_y, max_camera_y_tiles));
+                    centerCameraOn(target_map_x_tiles, target_map_y_tiles);
                 }
             }
         }
@@ -243,8 +402,6 @@ void Game::processContinuousInput(sf::Time deltaTime) {
 }
 
 void Game::update(sf::Time delta_time) { 
-    if (!window.isOpen()) return;
-    
     // Masterpiece flowing wave animation system
     sf::Time frame_delta = master_wave_clock.restart();
     float delta_seconds = frame_delta.asSeconds();
@@ -252,7 +409,26 @@ void Game::update(sf::Time delta_time) {
     // Smooth time interpolation to prevent stuttering
     float target_time = master_wave_time + delta_seconds;
     master_wave_time = master_wave_time * WAVE_INTERPOLATION_SMOOTH + target_time * (1.0f - WAVE_INTERPOLATION_SMOOTH);
+    updateWavePhases();
     
+    // Maintain compatibility with existing water timer
+    water_animation_timer += delta_time;
+    
+    // Update entities
+    previous_entity_positions.resize(entities.size());
+    for (size_t i = 0; i < entities.size(); ++i) {
+        auto& entity = entities[i];
+        previous_entity_positions[i] = std::make_pair(entity->x, entity->y);
+        entity->update();
+        entity->x = (entity->x % MAP_WIDTH + MAP_WIDTH) % MAP_WIDTH;
+        entity->y = (entity->y % MAP_HEIGHT + MAP_HEIGHT) % MAP_HEIGHT; 
+    }
+
+    ++simulation_tick;
+    publishSnapshot();
+}
+
+void Game::updateWavePhases() {
     // Calculate flowing wave phases with natural physics
     tide_phase = std::sin(master_wave_time * 2.0f * 3.14159f / World::Systems::Lakes::TIDE_CYCLE_TIME) * 0.5f + 0.5f;
     
@@ -270,45 +446,272 @@ void Game::update(sf::Time delta_time) {
     
     // Store for interpolation
     prev_wave_time = master_wave_time;
+}
+
+void Game::publishSnapshot() {
+    WorldSnapshot& snapshot = snapshot_buffer.writeBuffer();
+    snapshot.tick = simulation_tick;
+    snapshot.wave_flow_offset = wave_flow_offset;
+    snapshot.animation_time = master_wave_time;
+    snapshot.entities.resize(entities.size());
+    for (size_t i = 0; i < entities.size(); ++i) {
+        EntitySnapshot& entity_snapshot = snapshot.entities[i];
+        entity_snapshot.x = entities[i]->x;
+        entity_snapshot.y = entities[i]->y;
+        bool has_previous = i < previous_entity_positions.size();
+        entity_snapshot.prev_x = has_previous ? previous_entity_positions[i].first : entities[i]->x;
+        entity_snapshot.prev_y = has_previous ? previous_entity_positions[i].second : entities[i]->y;
+        entity_snapshot.display_cell = entities[i]->display_cell;
+    }
+    snapshot_buffer.publish();
+}
+
+void Game::consumeSnapshot() {
+    if (!snapshot_buffer.acquireLatest()) return;
+    snapshot_age_clock.restart();
+}
+
+void Game::updateMinimapTexture() { 
+    // Forward tile edits to the background builder, then upload whatever it has finished
+    int dirty_x = 0, dirty_y = 0, dirty_w = 0, dirty_h = 0;
+    if (game_map.takeDirtyTileRegion(World::DirtyTileConsumer::MINIMAP, dirty_x, dirty_y, dirty_w, dirty_h)) {
+        minimap_builder.markTilesDirty(dirty_x, dirty_y, dirty_w, dirty_h);
+    }
+    minimap_builder.uploadFinishedRegions(minimap_texture);
+}
+
+void Game::scrollComposedCells(int delta_cells_x, int delta_cells_y) {
+    // new(x, y) = old(x + dx, y + dy); cells with no source are marked volatile so they get composed
+    composed_cells_back.resize(composed_cells.size());
+    composed_cell_volatile_back.resize(composed_cell_volatile.size());
+    for (int screen_char_y = 0; screen_char_y < composed_rows; ++screen_char_y) {
+        int source_y = screen_char_y + delta_cells_y;
+        for (int screen_char_x = 0; screen_char_x < composed_cols; ++screen_char_x) {
+            int source_x = screen_char_x + delta_cells_x;
+            size_t slot = static_cast<size_t>(screen_char_y) * composed_cols + screen_char_x;
+            if (source_x >= 0 && source_x < composed_cols && source_y >= 0 && source_y < composed_rows) {
+                size_t source_slot = static_cast<size_t>(source_y) * composed_cols + source_x;
+                composed_cells_back[slot] = composed_cells[source_slot];
+                composed_cell_volatile_back[slot] = composed_cell_volatile[source_slot];
+            } else {
+                composed_cell_volatile_back[slot] = 1;
+            }
+        }
+    }
+    composed_cells.swap(composed_cells_back);
+    composed_cell_volatile.swap(composed_cell_volatile_back);
+}
+
+void Game::markEditedCellsVolatile(int origin_cell_x, int origin_cell_y,
+                                   int tile_x, int tile_y, int tile_width, int tile_height) {
+    // Cell (col, row) reads tile ((origin_cell_x + col) * scale, (origin_cell_y + row) * scale),
+    // or when zoomed out the pyramid texel over the scale x scale block starting there
+    const int scale = m_current_lod_scale;
+    int first_row = std::max(0, tile_y / scale - origin_cell_y);
+    int last_row = std::min(composed_rows - 1, (tile_y + tile_height - 1) / scale - origin_cell_y);
+    if (first_row > last_row) return;
+
+    for (int col = 0; col < composed_cols; ++col) {
+        int block_x = (origin_cell_x + col) * scale;
+        block_x = (block_x % MAP_WIDTH + MAP_WIDTH) % MAP_WIDTH;
+        // The block may run past the X seam; test the edit in that frame too
+        bool edited = (block_x < tile_x + tile_width && block_x + scale > tile_x) ||
+                      (block_x < tile_x + MAP_WIDTH + tile_width && block_x + scale > tile_x + MAP_WIDTH);
+        if (!edited) continue;
+        for (int row = first_row; row <= last_row; ++row) {
+            composed_cell_volatile[static_cast<size_t>(row) * composed_cols + col] = 1;
+        }
+    }
+}
+
+void Game::composeTerrainCell(int screen_char_x, int screen_char_y, int origin_cell_x, int origin_cell_y,
+                              float current_water_animation_progress,
+                              World::Systems::Lakes::LakeCellBatch& lake_batch) {
+    size_t slot = static_cast<size_t>(screen_char_y) * composed_cols + screen_char_x;
+    int map_tile_to_fetch_x = (origin_cell_x + screen_char_x) * m_current_lod_scale;
+    int map_tile_to_fetch_y = (origin_cell_y + screen_char_y) * m_current_lod_scale;
+
+    if (map_tile_to_fetch_y < 0 || map_tile_to_fetch_y >= MAP_HEIGHT) {
+        composed_cells[slot] = ScreenCell(' ', Colors::WHITE, Colors::DEFAULT_BG);
+        composed_cell_volatile[slot] = 0;
+        return;
+    }
+
+    // Zoomed out: one averaged colour per cell from the matching pyramid level (no animation).
+    // The pyramid is terrain only; vegetation objects are stamped over it in render() like at full zoom
+    const World::LodColorPyramid& lod_pyramid = game_map.getLodColorPyramid();
+    if (m_current_lod_scale > 1 && lod_pyramid.isBuilt()) {
+        composed_cells[slot] = ScreenCell(' ', Colors::WHITE,
+            lod_pyramid.sample(m_current_lod_level, map_tile_to_fetch_x, map_tile_to_fetch_y));
+        composed_cell_volatile[slot] = 0;
+        return;
+    }
+
+    Core::ScreenCell cell_for_renderer;
     
-    // Maintain compatibility with existing water timer
-    water_animation_timer += delta_time;
+    // Terrain only: vegetation objects are stamped on top afterwards (stampVegetationObjects)
+    const World::Tile& tile_to_draw = game_map.getTile(map_tile_to_fetch_x, map_tile_to_fetch_y);
     
-    // Update entities
-    for (auto& entity : entities) { 
-        entity->update();
-        entity->x = (entity->x % MAP_WIDTH + MAP_WIDTH) % MAP_WIDTH;
-        entity->y = (entity->y % MAP_HEIGHT + MAP_HEIGHT) % MAP_HEIGHT; 
+    if (tile_to_draw.base_type == World::BaseTileType::LAKE_WATER) {
+        // Deferred to the batched lake pass
+        lake_batch.add(static_cast<int>(slot),
+                            tile_to_draw.distance_to_land,
+                            tile_to_draw.animation_offset,
+                            tile_to_draw.wave_strand_intensity);
+        composed_cell_volatile[slot] = 1;
+        return;
+    } else if (World::Systems::Vegetation::VegetationTileRenderer::isWindDrivenType(tile_to_draw.base_type)) {
+        // Grass sways with the wind field: the local gust sets the phase, so neighbouring
+        // tiles move together and gust fronts sweep across the meadow
+        World::Systems::Wind::WindSample wind = wind_field.sample(map_tile_to_fetch_x, map_tile_to_fetch_y);
+        cell_for_renderer = vegetation_renderer.renderWindDriven(
+            tile_to_draw.base_type,
+            tile_to_draw.height_val,
+            tile_to_draw.slope_val,
+            tile_to_draw.aspect_val,
+            tile_to_draw.animation_offset,
+            current_water_animation_progress,
+            wind.gust,
+            wind.strength()
+        );
+        composed_cell_volatile[slot] = 1;
+    } else if (World::Tile::isAnimated(tile_to_draw.base_type)) {
+        cell_for_renderer = World::Tile::determineDisplay(
+            tile_to_draw.base_type, 
+            tile_to_draw.height_val, 
+            tile_to_draw.slope_val, 
+            tile_to_draw.aspect_val, 
+            tile_to_draw.distance_to_land, 
+            current_water_animation_progress,
+            tile_to_draw.animation_offset,
+            tile_to_draw.wave_strand_intensity,
+            tile_to_draw.is_marsh_water_patch,
+            tile_to_draw.distance_to_water
+        );
+        composed_cell_volatile[slot] = 1;
+    } else {
+        // Static types: the display cell finalised after generation is exact
+        cell_for_renderer = tile_to_draw.display_cell;
+        composed_cell_volatile[slot] = 0;
     }
+
+    if (m_current_lod_scale > 1) { 
+        cell_for_renderer.character = ' '; 
+    }
+    composed_cells[slot] = cell_for_renderer;
 }
 
-void Game::updateMinimapTexture() { 
-    if (!minimap_texture_needs_update) return;
-    sf::Image image;
-    image.create(MAP_WIDTH, MAP_HEIGHT); 
-    for (int y = 0; y < MAP_HEIGHT; ++y) {
-        for (int x = 0; x < MAP_WIDTH; ++x) {
-            const World::Tile& tile = game_map.getTile(x, y);
-            Core::ScreenCell minimap_cell = World::Tile::determineDisplay(
-                tile.base_type, tile.height_val, tile.slope_val, tile.aspect_val, 
-                tile.distance_to_land, 
-                0.0f, // global_water_animation_progress (static for minimap)
-                tile.animation_offset,
-                tile.wave_strand_intensity,
-                tile.is_marsh_water_patch,
-                tile.distance_to_water // Pass distance_to_water
-            );
-            image.setPixel(x, y, minimap_cell.bg_color);
+void Game::stampVegetationObjects(int origin_cell_x, int origin_cell_y, const WorldSnapshot& snapshot) {
+    using World::Systems::Vegetation::MultiTileObjects::VegetationObjectManager;
+    const VegetationObjectManager* object_manager = game_map.getVegetationObjectManager();
+    if (!object_manager) return;
+
+    // Cell (col, row) shows map tile ((origin_cell_x + col) * scale, (origin_cell_y + row) * scale)
+    const int scale = m_current_lod_scale;
+    auto floorDiv = [](int value, int divisor) {
+        return (value >= 0) ? value / divisor : -((-value + divisor - 1) / divisor);
+    };
+    object_manager->collectObjectsInRect(origin_cell_x * scale, origin_cell_y * scale,
+                                         (origin_cell_x + composed_cols) * scale,
+                                         (origin_cell_y + composed_rows) * scale,
+                                         MAP_WIDTH, visible_objects);
+
+    // Latest-placed first, so the first-placed object ends on top where footprints overlap
+    // (the same precedence as the object-id raster)
+    for (auto visible = visible_objects.rbegin(); visible != visible_objects.rend(); ++visible) {
+        const VegetationObjectManager::ObjectInstance& object = object_manager->getObject(visible->object_index);
+        int object_width = object_manager->getObjectWidth(object);
+        int object_height = object_manager->getObjectHeight(object);
+        int left = object.origin_x + visible->wrap_offset_x; // In the viewport's unwrapped frame
+
+        // Only the cells whose sampled tile falls inside the footprint; at low zoom an
+        // oak covers a handful of cells
+        int first_col = std::max(0, floorDiv(left + scale - 1, scale) - origin_cell_x);
+        int last_col = std::min(composed_cols - 1, floorDiv(left + object_width - 1, scale) - origin_cell_x);
+        int first_row = std::max(0, floorDiv(object.origin_y + scale - 1, scale) - origin_cell_y);
+        int last_row = std::min(composed_rows - 1, floorDiv(object.origin_y + object_height - 1, scale) - origin_cell_y);
+        if (first_col > last_col || first_row > last_row) continue;
+
+        // Entities standing under this object get the under-canopy view
+        object_entity_positions.clear();
+        for (const EntitySnapshot& entity : snapshot.entities) {
+            if (entity.x >= object.origin_x && entity.x < object.origin_x + object_width &&
+                entity.y >= object.origin_y && entity.y < object.origin_y + object_height) {
+                object_entity_positions.emplace_back(entity.x, entity.y);
+            }
+        }
+
+        // One wind sample per object: the whole crown sways together
+        float wind_strength = wind_field.sample(object.origin_x + object_width / 2,
+                                                object.origin_y + object_height / 2).strength();
+
+        for (int row = first_row; row <= last_row; ++row) {
+            int relative_y = (origin_cell_y + row) * scale - object.origin_y;
+            for (int col = first_col; col <= last_col; ++col) {
+                int relative_x = (origin_cell_x + col) * scale - left;
+                std::pair<int, int> tile_position(object.origin_x + relative_x, object.origin_y + relative_y);
+                bool entity_here = std::find(object_entity_positions.begin(), object_entity_positions.end(),
+                                             tile_position) != object_entity_positions.end();
+
+                ScreenCell object_cell;
+                if (!object_manager->getObjectTileDisplay(object, relative_x, relative_y, entity_here,
+                                                          snapshot.animation_time, wind_strength, object_cell)) {
+                    continue; // Fully transparent: the ground shows through
+                }
+                ScreenCell& target = frame_cells[static_cast<size_t>(row) * composed_cols + col];
+                if (object_cell.bg_color.a == 0) {
+                    if (scale > 1) continue; // A glyph alone is not drawn when zoomed out
+                    object_cell.bg_color = target.bg_color;
+                }
+                if (scale > 1) {
+                    object_cell.character = ' ';
+                }
+                target = object_cell;
+            }
         }
     }
-    minimap_texture.update(image);
-    minimap_texture_needs_update = false; 
 }
 
 void Game::render() {
-    window.clear(Colors::DEFAULT_BG); 
-    game_renderer.prepareFrame(); 
+    sf::Clock stage_clock;
+    if (!headless) {
+        window.clear(Colors::DEFAULT_BG); 
+    }
+    frame_profiler.addStageTime(FrameStage::DRAW, stage_clock.restart());
 
+    composeFrameCells();
+    render_backend->prepareFrame(); 
+    #pragma omp parallel for schedule(static)
+    for (int screen_char_y = 0; screen_char_y < composed_rows; ++screen_char_y) {
+        for (int screen_char_x = 0; screen_char_x < composed_cols; ++screen_char_x) {
+            render_backend->setCell(screen_char_x, screen_char_y,
+                                    frame_cells[static_cast<size_t>(screen_char_y) * composed_cols + screen_char_x]);
+        }
+    }
+    frame_profiler.addStageTime(FrameStage::COMPOSE, stage_clock.restart());
+
+    render_backend->buildFrame();
+    frame_profiler.addStageTime(FrameStage::VERTICES, stage_clock.restart());
+    render_backend->present(render_pixel_offset_x, render_pixel_offset_y);
+    frame_profiler.addStageTime(FrameStage::DRAW, stage_clock.restart());
+
+    if (show_minimap) {
+        renderMinimapOverlay();
+    }
+    frame_profiler.addStageTime(FrameStage::MINIMAP, stage_clock.restart());
+
+    if (show_profiler) {
+        frame_profiler.draw(window, game_renderer.getFont());
+        frame_profiler.addStageTime(FrameStage::DRAW, stage_clock.restart());
+    }
+
+    if (!headless) {
+        window.display();
+    }
+    frame_profiler.addStageTime(FrameStage::DISPLAY, stage_clock.restart());
+}
+
+void Game::composeFrameCells() {
     float camera_lod_cell_x = camera_x / static_cast<float>(m_current_lod_scale);
     float camera_lod_cell_y = camera_y / static_cast<float>(m_current_lod_scale);
     render_pixel_offset_x = -(std::fmod(camera_lod_cell_x, 1.0f) * current_char_cell_width_px);
@@ -318,61 +721,116 @@ void Game::render() {
     int chars_to_draw_y = current_screen_height_chars + 2;
 
     // Use the masterpiece flowing wave animation progress
-    float current_water_animation_progress = wave_flow_offset;
-
-    for (int screen_char_y = 0; screen_char_y < chars_to_draw_y; ++screen_char_y) {
-        for (int screen_char_x = 0; screen_char_x < chars_to_draw_x; ++screen_char_x) {
-            int map_tile_to_fetch_x = static_cast<int>(std::floor(camera_x / m_current_lod_scale) + screen_char_x) * m_current_lod_scale;
-            int map_tile_to_fetch_y = static_cast<int>(std::floor(camera_y / m_current_lod_scale) + screen_char_y) * m_current_lod_scale;
-            
-            if (map_tile_to_fetch_y < 0 || map_tile_to_fetch_y >= MAP_HEIGHT) continue;
-
-            Core::ScreenCell cell_for_renderer;
-            
-            // ===== NEW: CHECK FOR MULTI-TILE VEGETATION OBJECTS FIRST =====
-            if (game_map.hasVegetationObjectAt(map_tile_to_fetch_x, map_tile_to_fetch_y)) {
-                // Find entity position for under-canopy rendering
-                int entity_x = -1, entity_y = -1;
-                for (const auto& entity : entities) {
-                    if (static_cast<int>(entity->x) == map_tile_to_fetch_x && 
-                        static_cast<int>(entity->y) == map_tile_to_fetch_y) {
-                        entity_x = static_cast<int>(entity->x);
-                        entity_y = static_cast<int>(entity->y);
-                        break;
-                    }
-                }
-                
-                cell_for_renderer = game_map.getVegetationObjectDisplay(
-                    map_tile_to_fetch_x, map_tile_to_fetch_y, entity_x, entity_y);
-            } else {
-                // ===== ORIGINAL TILE RENDERING =====
-                const World::Tile& tile_to_draw = game_map.getTile(map_tile_to_fetch_x, map_tile_to_fetch_y);
-                
-                cell_for_renderer = World::Tile::determineDisplay(
-                    tile_to_draw.base_type, 
-                    tile_to_draw.height_val, 
-                    tile_to_draw.slope_val, 
-                    tile_to_draw.aspect_val, 
-                    tile_to_draw.distance_to_land, 
-                    current_water_animation_progress,
-                    tile_to_draw.animation_offset,
-                    tile_to_draw.wave_strand_intensity,
-                    tile_to_draw.is_marsh_water_patch,
-                    tile_to_draw.distance_to_water
-                );
+    const WorldSnapshot& snapshot = snapshot_buffer.readBuffer();
+    float current_water_animation_progress = snapshot.wave_flow_offset;
+    lake_cell_batch.clear();
+
+    int origin_cell_x = static_cast<int>(std::floor(camera_x / m_current_lod_scale));
+    int origin_cell_y = static_cast<int>(std::floor(camera_y / m_current_lod_scale));
+
+    // Wind only where it is read this frame: visible grass, and object centres (an object's
+    // centre is never more than half its width, well under one wind node, off screen)
+    wind_field.updateRegion(snapshot.animation_time,
+                            origin_cell_x * m_current_lod_scale, origin_cell_y * m_current_lod_scale,
+                            (origin_cell_x + chars_to_draw_x) * m_current_lod_scale,
+                            (origin_cell_y + chars_to_draw_y) * m_current_lod_scale);
+
+    // ===== SCROLL REUSE =====
+    // Tiles edited since the last frame; cached cells that sample them are recomposed below
+    int edited_tile_x = 0, edited_tile_y = 0, edited_tile_w = 0, edited_tile_h = 0;
+    bool tiles_edited = game_map.takeDirtyTileRegion(World::DirtyTileConsumer::RENDER_CACHE,
+                                                     edited_tile_x, edited_tile_y, edited_tile_w, edited_tile_h);
+    bool reuse_cells = RENDER_REUSE_SCROLLED_CELLS && composed_cells_valid &&
+                       composed_cols == chars_to_draw_x && composed_rows == chars_to_draw_y &&
+                       composed_lod_scale == m_current_lod_scale;
+    if (reuse_cells) {
+        int delta_cells_x = origin_cell_x - composed_origin_cell_x;
+        int delta_cells_y = origin_cell_y - composed_origin_cell_y;
+
+        // The map wraps on X: crossing the seam is a small step, not a jump across the whole map
+        if (MAP_WIDTH % m_current_lod_scale == 0) {
+            int wrap_period_cells = MAP_WIDTH / m_current_lod_scale;
+            delta_cells_x = ((delta_cells_x % wrap_period_cells) + wrap_period_cells) % wrap_period_cells;
+            if (delta_cells_x > wrap_period_cells / 2) delta_cells_x -= wrap_period_cells;
+        }
+
+        if (std::abs(delta_cells_x) < chars_to_draw_x && std::abs(delta_cells_y) < chars_to_draw_y) {
+            if (delta_cells_x != 0 || delta_cells_y != 0) {
+                scrollComposedCells(delta_cells_x, delta_cells_y);
             }
+        } else {
+            reuse_cells = false;
+        }
+    }
+    if (!reuse_cells) {
+        size_t cell_count = static_cast<size_t>(chars_to_draw_x) * chars_to_draw_y;
+        composed_cells.assign(cell_count, ScreenCell(' ', Colors::WHITE, Colors::DEFAULT_BG));
+        composed_cell_volatile.assign(cell_count, 1);
+        composed_cols = chars_to_draw_x;
+        composed_rows = chars_to_draw_y;
+        composed_lod_scale = m_current_lod_scale;
+    }
+    composed_origin_cell_x = origin_cell_x;
+    composed_origin_cell_y = origin_cell_y;
+    composed_cells_valid = true;
+    if (reuse_cells && tiles_edited) {
+        markEditedCellsVolatile(origin_cell_x, origin_cell_y, edited_tile_x, edited_tile_y, edited_tile_w, edited_tile_h);
+    }
 
-            if (m_current_lod_scale > 1) { 
-                cell_for_renderer.character = ' '; 
+    // Only volatile cells (everything after a reset) are recomputed. Rows are split into
+    // static bands across threads; each cell writes only its own slot, and lake cells go to
+    // per-thread batches merged in thread order (= row-major order)
+    lake_cell_batches_per_thread.resize(omp_get_max_threads());
+    for (auto& thread_batch : lake_cell_batches_per_thread) {
+        thread_batch.clear();
+    }
+
+    long long cells_composed = 0;
+    #pragma omp parallel
+    {
+        World::Systems::Lakes::LakeCellBatch& local_lake_batch = lake_cell_batches_per_thread[omp_get_thread_num()];
+
+        #pragma omp for schedule(static) reduction(+:cells_composed)
+        for (int screen_char_y = 0; screen_char_y < chars_to_draw_y; ++screen_char_y) {
+            for (int screen_char_x = 0; screen_char_x < chars_to_draw_x; ++screen_char_x) {
+                size_t slot = static_cast<size_t>(screen_char_y) * chars_to_draw_x + screen_char_x;
+                if (!composed_cell_volatile[slot]) continue;
+                composeTerrainCell(screen_char_x, screen_char_y, origin_cell_x, origin_cell_y,
+                                   current_water_animation_progress, local_lake_batch);
+                ++cells_composed;
             }
-            game_renderer.setCell(screen_char_x, screen_char_y, cell_for_renderer);
         }
     }
+    cells_composed_last_frame = static_cast<size_t>(cells_composed);
+    for (const auto& thread_batch : lake_cell_batches_per_thread) {
+        lake_cell_batch.append(thread_batch);
+    }
+
+    // Batched lake shading: wave phases are evaluated once for the frame
+    lake_renderer.renderLakeBatch(lake_cell_batch, current_water_animation_progress, lake_batch_cells);
+    for (size_t i = 0; i < lake_batch_cells.size(); ++i) {
+        if (m_current_lod_scale > 1) {
+            lake_batch_cells[i].character = ' ';
+        }
+        composed_cells[static_cast<size_t>(lake_cell_batch.cell_slot[i])] = lake_batch_cells[i];
+    }
+
+    // Vegetation objects: one viewport query, then each visible object's pattern is stamped
+    frame_cells = composed_cells;
+    stampVegetationObjects(origin_cell_x, origin_cell_y, snapshot);
 
-    // Entity rendering - same as before
-    for (const auto& entity : entities) { 
-        float entity_rel_map_x = static_cast<float>(entity->x) - camera_x;
-        float entity_rel_map_y = static_cast<float>(entity->y) - camera_y;
+    // Entity rendering - interpolated between the last two simulation ticks
+    float tick_alpha = std::min(1.0f, snapshot_age_clock.getElapsedTime().asMicroseconds() / (MS_PER_TICK * 1000.0f));
+    for (const EntitySnapshot& entity : snapshot.entities) { 
+        float step_x = static_cast<float>(entity.x - entity.prev_x);
+        if (std::abs(step_x) > static_cast<float>(MAP_WIDTH) / 2.0f) {
+            step_x += (step_x > 0) ? -static_cast<float>(MAP_WIDTH) : static_cast<float>(MAP_WIDTH); // Wrapped across the seam
+        }
+        float step_y = static_cast<float>(entity.y - entity.prev_y);
+        float entity_map_x = std::round(static_cast<float>(entity.prev_x) + step_x * tick_alpha);
+        float entity_map_y = std::round(static_cast<float>(entity.prev_y) + step_y * tick_alpha);
+        float entity_rel_map_x = entity_map_x - camera_x;
+        float entity_rel_map_y = entity_map_y - camera_y;
         if (std::abs(entity_rel_map_x) > static_cast<float>(MAP_WIDTH) / 2.0f) {
             if (entity_rel_map_x > 0) entity_rel_map_x -= static_cast<float>(MAP_WIDTH);
             else entity_rel_map_x += static_cast<float>(MAP_WIDTH);
@@ -380,18 +838,9 @@ void Game::render() {
         int screen_char_x = static_cast<int>(std::floor(entity_rel_map_x / m_current_lod_scale));
         int screen_char_y = static_cast<int>(std::floor(entity_rel_map_y / m_current_lod_scale));
         if (screen_char_x >= 0 && screen_char_x < chars_to_draw_x && screen_char_y >= 0 && screen_char_y < chars_to_draw_y) {
-            Core::ScreenCell entity_cell = entity->display_cell;
-            game_renderer.setCell(screen_char_x, screen_char_y, entity_cell);
+            frame_cells[static_cast<size_t>(screen_char_y) * chars_to_draw_x + screen_char_x] = entity.display_cell;
         }
     }
-    
-    game_renderer.render(window, render_pixel_offset_x, render_pixel_offset_y);
-
-    if (show_minimap) {
-        renderMinimapOverlay();
-    }
-
-    window.display();
 }
 
 void Game::renderMinimapOverlay() { 
@@ -406,7 +855,7 @@ void Game::renderMinimapOverlay() {
     float vp_map_w_tiles = static_cast<float>(current_screen_width_chars * m_current_lod_scale);
     float vp_map_h_tiles = static_cast<float>(current_screen_height_chars * m_current_lod_scale);
     sf::Vector2f minimap_pos = minimap_sprite.getPosition();
-    sf::Vector2f minimap_scale = minimap_sprite.getScale();
+    sf::Vector2f minimap_scale = minimap_tiles_to_px;
     float first_part_w_tiles = vp_map_w_tiles;
     float second_part_w_tiles = 0.0f;
     if (vp_map_x_tiles + vp_map_w_tiles > MAP_WIDTH) {
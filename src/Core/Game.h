@@ -3,45 +3,86 @@
 
 #include <SFML/Graphics.hpp>
 #include "Renderer.h"
+#include "SoftwareRenderer.h"
+#include "IRenderBackend.h"
+#include "MinimapBuilder.h"
+#include "FrameProfiler.h"
+#include "CameraPathBenchmark.h"
+#include "SimulationThread.h"
+#include "TripleBuffer.h"
+#include "WorldSnapshot.h"
 #include "../World/Map.h"
+#include "../World/Systems/Lakes/LakeTileRenderer.h"
+#include "../World/Systems/Wind/WindField.h"
+#include "../World/Systems/Vegetation/VegetationTileRenderer.h"
+#include "../World/Systems/Vegetation/MultiTileObjects/VegetationObjectManager.h"
 #include "../Entities/Entity.h"
 #include <vector>
 #include <memory>
+#include <utility>
+#include <string>
 
 namespace Core {
 
 class Game {
 public:
     Game();
+    // Headless: no window; frames go through SoftwareRenderer instead of Renderer
+    explicit Game(unsigned int world_seed, bool headless_mode = false);
     ~Game();
 
     bool initialize();
     void run();
+    // Replay the scripted CameraPathBenchmark without user input and print its report
+    void runBenchmark();
+    // Headless only: render the map centre once and write it as an image
+    bool runScreenshot(const std::string& output_path);
 
 private:
     void handleEvent(sf::Event& event);
     void processContinuousInput(sf::Time deltaTime);
-    void update(sf::Time delta_time);
+    void update(sf::Time delta_time);          // Simulation thread only
+    void updateWavePhases();                   // From master_wave_time; same thread as update()
+    void publishSnapshot();                    // Simulation thread only (or while it is not running)
+    void consumeSnapshot();                    // Render thread
+    void freezeAnimationAt(float animation_time_seconds); // Only while the simulation thread is not running
     void render();
+    void composeFrameCells();                  // Terrain, objects and entities into frame_cells
     void updateZoom(float new_zoom_factor);
+    void centerCameraOn(float map_x_tiles, float map_y_tiles);
+    void scrollComposedCells(int delta_cells_x, int delta_cells_y);
+    void markEditedCellsVolatile(int origin_cell_x, int origin_cell_y,
+                                 int tile_x, int tile_y, int tile_width, int tile_height);
+    void composeTerrainCell(int screen_char_x, int screen_char_y, int origin_cell_x, int origin_cell_y,
+                            float current_water_animation_progress,
+                            World::Systems::Lakes::LakeCellBatch& lake_batch);
+    void stampVegetationObjects(int origin_cell_x, int origin_cell_y, const WorldSnapshot& snapshot);
 
     bool initializeMinimapOverlay();
     void updateMinimapTexture();
     void renderMinimapOverlay();
 
-    sf::RenderWindow window;
+    unsigned int world_seed;
+    bool headless;
+    sf::RenderWindow window;                  // Not created when headless
 
     Renderer game_renderer;
+    SoftwareRenderer software_renderer;
+    IRenderBackend* render_backend;           // One of the two above, chosen by initialize()
     World::Map game_map;
-    std::vector<std::unique_ptr<Entities::Entity>> entities;
+    std::vector<std::unique_ptr<Entities::Entity>> entities; // Owned by the simulation thread once started
 
-    sf::Texture minimap_texture;
+    sf::Texture minimap_texture;              // At overlay resolution, filled by minimap_builder
     sf::Sprite minimap_sprite;
     sf::RectangleShape minimap_viewport_rect;
     sf::RectangleShape minimap_background_rect;
-    bool minimap_texture_needs_update;
+    sf::Vector2f minimap_tiles_to_px;         // Map tiles -> overlay pixels
+    MinimapBuilder minimap_builder;           // Declared after game_map: stops before the map is destroyed
     bool show_minimap;
 
+    FrameProfiler frame_profiler;             // P toggles the overlay, Shift+P the CSV stream
+    bool show_profiler;
+
     float current_zoom_factor;
     unsigned int current_sfml_font_size;
     int current_char_cell_width_px;  
@@ -50,6 +91,7 @@ private:
     int current_screen_height_chars;
 
     int m_current_lod_scale;
+    int m_current_lod_level; // log2(m_current_lod_scale): the LodColorPyramid level sampled
 
     float camera_x;
     float camera_y;
@@ -59,7 +101,7 @@ private:
 
     sf::Clock delta_clock;
 
-    // --- Masterpiece Flowing Wave Animation System ---
+    // --- Masterpiece Flowing Wave Animation System (advanced by the simulation thread) ---
     sf::Time water_animation_timer;
     sf::Clock master_wave_clock;               // Master timing for wave flow
     float master_wave_time;                    // Continuous wave time in seconds
@@ -73,6 +115,43 @@ private:
     // Smooth animation interpolation
     float prev_wave_time;                      // Previous frame time for interpolation
     static constexpr float WAVE_INTERPOLATION_SMOOTH = 0.92f;
+
+    // Visible LAKE_WATER cells are collected during the tile pass and shaded in one batch
+    World::Systems::Lakes::LakeTileRenderer lake_renderer;
+    World::Systems::Wind::WindField wind_field; // Render thread: re-evaluated once per frame from the snapshot time
+    World::Systems::Vegetation::VegetationTileRenderer vegetation_renderer; // Wind-driven grass at render time
+    World::Systems::Lakes::LakeCellBatch lake_cell_batch;
+    std::vector<World::Systems::Lakes::LakeCellBatch> lake_cell_batches_per_thread; // Merged in thread order
+    std::vector<ScreenCell> lake_batch_cells;
+
+    // Terrain cells composed last frame (entities excluded). When the camera pans by whole
+    // cells they are shifted instead of recomputed; volatile cells are refreshed every frame.
+    std::vector<ScreenCell> composed_cells;
+    std::vector<ScreenCell> composed_cells_back;
+    std::vector<unsigned char> composed_cell_volatile; // 1 = animated/newly exposed/edited tile
+    std::vector<unsigned char> composed_cell_volatile_back;
+    int composed_origin_cell_x;
+    int composed_origin_cell_y;
+    int composed_cols;
+    int composed_rows;
+    int composed_lod_scale;
+    bool composed_cells_valid;
+    size_t cells_composed_last_frame; // Terrain cells recomputed (not reused) by the last render()
+
+    // Vegetation objects and entities are stamped over a per-frame copy of the terrain cells, so
+    // the terrain cache never holds them; this is the grid every backend receives
+    std::vector<ScreenCell> frame_cells;
+    std::vector<World::Systems::Vegetation::MultiTileObjects::VegetationObjectManager::VisibleObject> visible_objects;
+    std::vector<std::pair<int, int>> object_entity_positions; // Entities under the object being stamped
+
+    // ===== SIMULATION THREAD =====
+    // Simulation side: tick counter and entity positions at the previous tick
+    unsigned long long simulation_tick;
+    std::vector<std::pair<int, int>> previous_entity_positions;
+    TripleBuffer<WorldSnapshot> snapshot_buffer;
+    // Render side
+    sf::Clock snapshot_age_clock;             // Time since the current snapshot arrived, for interpolation
+    SimulationThread simulation_thread;       // Declared last: stopped before anything it ticks is destroyed
 };
 
 } // namespace Core
\ No newline at end of file
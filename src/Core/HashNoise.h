@@ -0,0 +1,69 @@
+// File: EmergentKingdoms/src/Core/HashNoise.h
+#pragma once
+
+#include <cstdint>
+#include <cmath>
+
+namespace Core {
+
+/**
+ * Stateless integer-hash noise for procedural generation. Every value is a pure
+ * function of (seed, coordinates): nothing is seeded or stored, so cells can be
+ * sampled in any order and from any thread. Built on the splitmix64 finaliser;
+ * good statistical quality, not for cryptographic use.
+ */
+namespace HashNoise {
+
+// splitmix64 finaliser: every input bit affects every output bit
+inline std::uint64_t mix64(std::uint64_t z) {
+    z += 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+inline std::uint32_t hash1D(std::uint32_t seed, int n) {
+    std::uint64_t key = (static_cast<std::uint64_t>(seed) << 32) | static_cast<std::uint32_t>(n);
+    return static_cast<std::uint32_t>(mix64(key) >> 32);
+}
+
+inline std::uint32_t hash2D(std::uint32_t seed, int x, int y) {
+    std::uint64_t key = (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) |
+                        static_cast<std::uint32_t>(y);
+    return static_cast<std::uint32_t>(mix64(key ^ mix64(seed)) >> 32);
+}
+
+// Top 24 bits as a float in [0, 1)
+inline float toUnitFloat(std::uint32_t hash) {
+    return static_cast<float>(hash >> 8) * (1.0f / 16777216.0f);
+}
+
+// Float in [-1, 1)
+inline float toSignedFloat(std::uint32_t hash) {
+    return toUnitFloat(hash) * 2.0f - 1.0f;
+}
+
+// Smooth value noise in [0, 1): hashed lattice values, smoothstep-blended between
+// integer coordinates
+inline float valueNoise2D(std::uint32_t seed, float x, float y) {
+    float floor_x = std::floor(x);
+    float floor_y = std::floor(y);
+    int cell_x = static_cast<int>(floor_x);
+    int cell_y = static_cast<int>(floor_y);
+    float tx = x - floor_x;
+    float ty = y - floor_y;
+    tx = tx * tx * (3.0f - 2.0f * tx);
+    ty = ty * ty * (3.0f - 2.0f * ty);
+
+    float v00 = toUnitFloat(hash2D(seed, cell_x, cell_y));
+    float v10 = toUnitFloat(hash2D(seed, cell_x + 1, cell_y));
+    float v01 = toUnitFloat(hash2D(seed, cell_x, cell_y + 1));
+    float v11 = toUnitFloat(hash2D(seed, cell_x + 1, cell_y + 1));
+
+    float top = v00 + (v10 - v00) * tx;
+    float bottom = v01 + (v11 - v01) * tx;
+    return top + (bottom - top) * ty;
+}
+
+} // namespace HashNoise
+} // namespace Core
@@ -0,0 +1,36 @@
+// File: EmergentKingdoms/src/Core/IRenderBackend.h
+#pragma once
+
+#include "ScreenCell.h"
+
+namespace Core {
+
+/**
+ * Output stage for the ScreenCell grid Game composes each frame.
+ * Renderer draws it into the SFML window; SoftwareRenderer rasterises it into a
+ * CPU pixel buffer without a window or OpenGL context. The grid is the screen
+ * size in cells plus a one-cell margin on every side, as passed to updateLayout.
+ */
+class IRenderBackend {
+public:
+    virtual ~IRenderBackend() = default;
+
+    virtual void updateLayout(unsigned int new_sfml_font_size,
+                              int new_char_cell_width_px, int new_char_cell_height_px,
+                              int new_screen_width_chars, int new_screen_height_chars) = 0;
+    virtual void prepareFrame() = 0;
+    virtual void setCell(int x, int y, const ScreenCell& cell) = 0;
+
+    // The two halves of render(), callable separately so they can be timed apart
+    virtual void buildFrame() = 0;                                    // Cells -> backend frame data
+    virtual void present(float pixel_shift_x, float pixel_shift_y) = 0; // Frame data -> target
+    void render(float pixel_shift_x = 0.0f, float pixel_shift_y = 0.0f) {
+        buildFrame();
+        present(pixel_shift_x, pixel_shift_y);
+    }
+
+    virtual void shutdown() = 0;
+    virtual bool isInitialized() const = 0;
+};
+
+} // namespace Core
@@ -0,0 +1,194 @@
+// File: EmergentKingdoms/src/Core/MinimapBuilder.cpp
+#include "MinimapBuilder.h"
+#include "../World/Map.h"
+#include <iostream>
+#include <algorithm>
+
+namespace Core {
+
+MinimapBuilder::~MinimapBuilder() {
+    stop();
+}
+
+void MinimapBuilder::start(const World::Map& source_map, unsigned int minimap_width_px, unsigned int minimap_height_px) {
+    stop();
+    map = &source_map;
+    map_width = source_map.getWidth();
+    map_height = source_map.getHeight();
+    width_px = static_cast<int>(minimap_width_px);
+    height_px = static_cast<int>(minimap_height_px);
+    if (width_px <= 0 || height_px <= 0) return;
+
+    const World::LodColorPyramid& pyramid = source_map.getLodColorPyramid();
+    int footprint_tiles = std::min(map_width / width_px, map_height / height_px);
+    pyramid_level = 0;
+    while (pyramid_level < pyramid.getLevelCount() && (2 << pyramid_level) <= footprint_tiles) {
+        ++pyramid_level;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        stopping = false;
+        pending_regions.clear();
+        finished_regions.clear();
+    }
+    queueRegion(PixelRect{0, 0, width_px, height_px});
+    worker = std::thread(&MinimapBuilder::workerLoop, this);
+    std::cout << "  Minimap builder: " << width_px << "x" << height_px << " px in the background." << std::endl;
+}
+
+void MinimapBuilder::stop() {
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        stopping = true;
+    }
+    queue_wake.notify_all();
+    if (worker.joinable()) {
+        worker.join();
+    }
+}
+
+void MinimapBuilder::markTilesDirty(int tile_x, int tile_y, int tile_width, int tile_height) {
+    if (map == nullptr || tile_width <= 0 || tile_height <= 0) return;
+
+    // Widen to whole pyramid texels: a pixel reads every texel its footprint touches,
+    // so an edit reaches every pixel whose footprint meets the edited texels
+    int texel_mask = (1 << pyramid_level) - 1;
+    int tile_end_x = ((tile_x + tile_width + texel_mask) >> pyramid_level) << pyramid_level;
+    int tile_end_y = ((tile_y + tile_height + texel_mask) >> pyramid_level) << pyramid_level;
+    tile_x = (tile_x >> pyramid_level) << pyramid_level;
+    tile_y = (tile_y >> pyramid_level) << pyramid_level;
+    tile_width = tile_end_x - tile_x;
+    tile_height = tile_end_y - tile_y;
+
+    // Pixels whose tile footprint [p * map / px, (p + 1) * map / px) meets the tile rectangle
+    PixelRect rect;
+    rect.x = std::max(0, static_cast<int>(static_cast<long long>(tile_x) * width_px / map_width));
+    rect.y = std::max(0, static_cast<int>(static_cast<long long>(tile_y) * height_px / map_height));
+    int end_x = static_cast<int>((static_cast<long long>(tile_x + tile_width) * width_px + map_width - 1) / map_width);
+    int end_y = static_cast<int>((static_cast<long long>(tile_y + tile_height) * height_px + map_height - 1) / map_height);
+    rect.width = std::min(width_px, end_x) - rect.x;
+    rect.height = std::min(height_px, end_y) - rect.y;
+    if (rect.width <= 0 || rect.height <= 0) return;
+
+    queueRegion(rect);
+}
+
+void MinimapBuilder::queueRegion(const PixelRect& rect) {
+    PendingRegion pending;
+    pending.rect = rect;
+    captureTexels(pending);
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        pending_regions.push_back(std::move(pending));
+    }
+    queue_wake.notify_one();
+}
+
+void MinimapBuilder::captureTexels(PendingRegion& pending) const {
+    // Texels under the footprint of the region's first and last pixels
+    int tile_x0 = 0, tile_y0 = 0, tile_x1 = 0, tile_y1 = 0;
+    int last_x1 = 0, last_y1 = 0, unused_x = 0, unused_y = 0;
+    pixelFootprint(pending.rect.x, pending.rect.y, tile_x0, tile_y0, tile_x1, tile_y1);
+    pixelFootprint(pending.rect.x + pending.rect.width - 1, pending.rect.y + pending.rect.height - 1,
+                   unused_x, unused_y, last_x1, last_y1);
+    pending.texel_x = tile_x0 >> pyramid_level;
+    pending.texel_y = tile_y0 >> pyramid_level;
+    pending.texel_width = ((last_x1 - 1) >> pyramid_level) + 1 - pending.texel_x;
+    pending.texel_height = ((last_y1 - 1) >> pyramid_level) + 1 - pending.texel_y;
+
+    // display_cell is finalised at animation progress 0, which is what the minimap shows
+    const World::LodColorPyramid& pyramid = map->getLodColorPyramid();
+    pending.texels.resize(static_cast<size_t>(pending.texel_width) * pending.texel_height);
+    for (int row = 0; row < pending.texel_height; ++row) {
+        for (int col = 0; col < pending.texel_width; ++col) {
+            int tile_x = (pending.texel_x + col) << pyramid_level;
+            int tile_y = (pending.texel_y + row) << pyramid_level;
+            pending.texels[static_cast<size_t>(row) * pending.texel_width + col] =
+                (pyramid_level == 0) ? map->getTile(tile_x, tile_y).display_cell.bg_color
+                                     : pyramid.sample(pyramid_level, tile_x, tile_y);
+        }
+    }
+}
+
+bool MinimapBuilder::uploadFinishedRegions(sf::Texture& minimap_texture) {
+    std::vector<FinishedRegion> ready;
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        ready.swap(finished_regions);
+    }
+    for (const FinishedRegion& region : ready) {
+        minimap_texture.update(region.pixels.data(),
+                               static_cast<unsigned int>(region.rect.width), static_cast<unsigned int>(region.rect.height),
+                               static_cast<unsigned int>(region.rect.x), static_cast<unsigned int>(region.rect.y));
+    }
+    return !ready.empty();
+}
+
+void MinimapBuilder::workerLoop() {
+    while (true) {
+        std::vector<PendingRegion> regions;
+        {
+            std::unique_lock<std::mutex> lock(queue_mutex);
+            queue_wake.wait(lock, [this] { return stopping || !pending_regions.empty(); });
+            if (stopping) return;
+            regions.swap(pending_regions);
+        }
+
+        for (const PendingRegion& pending : regions) {
+            FinishedRegion region;
+            region.rect = pending.rect;
+            buildRegion(pending, region);
+
+            std::lock_guard<std::mutex> lock(queue_mutex);
+            if (stopping) return;
+            finished_regions.push_back(std::move(region));
+        }
+    }
+}
+
+void MinimapBuilder::buildRegion(const PendingRegion& pending, FinishedRegion& region) const {
+    region.pixels.resize(static_cast<size_t>(region.rect.width) * region.rect.height * 4);
+    for (int row = 0; row < region.rect.height; ++row) {
+        for (int col = 0; col < region.rect.width; ++col) {
+            sf::Color color = samplePixel(pending, region.rect.x + col, region.rect.y + row);
+            size_t offset = (static_cast<size_t>(row) * region.rect.width + col) * 4;
+            region.pixels[offset] = color.r;
+            region.pixels[offset + 1] = color.g;
+            region.pixels[offset + 2] = color.b;
+            region.pixels[offset + 3] = 255;
+        }
+    }
+}
+
+void MinimapBuilder::pixelFootprint(int pixel_x, int pixel_y, int& tile_x0, int& tile_y0, int& tile_x1, int& tile_y1) const {
+    tile_x0 = static_cast<int>(static_cast<long long>(pixel_x) * map_width / width_px);
+    tile_y0 = static_cast<int>(static_cast<long long>(pixel_y) * map_height / height_px);
+    tile_x1 = std::max(tile_x0 + 1, static_cast<int>(static_cast<long long>(pixel_x + 1) * map_width / width_px));
+    tile_y1 = std::max(tile_y0 + 1, static_cast<int>(static_cast<long long>(pixel_y + 1) * map_height / height_px));
+}
+
+sf::Color MinimapBuilder::samplePixel(const PendingRegion& pending, int pixel_x, int pixel_y) const {
+    int tile_x0 = 0, tile_y0 = 0, tile_x1 = 0, tile_y1 = 0;
+    pixelFootprint(pixel_x, pixel_y, tile_x0, tile_y0, tile_x1, tile_y1);
+
+    // Average the captured level texels (or tiles, at level 0) under the footprint
+    unsigned int sum_r = 0, sum_g = 0, sum_b = 0, count = 0;
+    int last_texel_x = (tile_x1 - 1) >> pyramid_level;
+    int last_texel_y = (tile_y1 - 1) >> pyramid_level;
+    for (int texel_y = tile_y0 >> pyramid_level; texel_y <= last_texel_y; ++texel_y) {
+        for (int texel_x = tile_x0 >> pyramid_level; texel_x <= last_texel_x; ++texel_x) {
+            const sf::Color& color = pending.texels[static_cast<size_t>(texel_y - pending.texel_y) * pending.texel_width
+                                                    + (texel_x - pending.texel_x)];
+            sum_r += color.r;
+            sum_g += color.g;
+            sum_b += color.b;
+            ++count;
+        }
+    }
+    return sf::Color(static_cast<sf::Uint8>((sum_r + count / 2) / count),
+                     static_cast<sf::Uint8>((sum_g + count / 2) / count),
+                     static_cast<sf::Uint8>((sum_b + count / 2) / count));
+}
+
+} // namespace Core
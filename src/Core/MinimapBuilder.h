@@ -0,0 +1,90 @@
+// File: EmergentKingdoms/src/Core/MinimapBuilder.h
+#pragma once
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <SFML/Graphics.hpp>
+
+namespace World {
+class Map;
+}
+
+namespace Core {
+
+/**
+ * Builds the minimap at its on-screen resolution on a worker thread.
+ * Each pixel averages the tile colours under its footprint, read from the
+ * map's LOD colour pyramid. Changed tile regions are queued with
+ * markTilesDirty; the worker rebuilds only the pixels they cover and the main
+ * thread uploads each finished sub-rectangle with Texture::update.
+ *
+ * start() and markTilesDirty() run on the thread that edits tiles (the main
+ * thread) and copy the pyramid texels a region needs into the queued job, so
+ * the worker never reads the map while setTile rewrites it.
+ */
+class MinimapBuilder {
+public:
+    MinimapBuilder() = default;
+    ~MinimapBuilder();
+
+    MinimapBuilder(const MinimapBuilder&) = delete;
+    MinimapBuilder& operator=(const MinimapBuilder&) = delete;
+
+    // Start the worker and queue a full build
+    void start(const World::Map& source_map, unsigned int minimap_width_px, unsigned int minimap_height_px);
+    void stop();
+
+    // Queue a rebuild of the minimap pixels covering a tile rectangle
+    void markTilesDirty(int tile_x, int tile_y, int tile_width, int tile_height);
+
+    // Main thread: upload every finished region; returns true if the texture changed
+    bool uploadFinishedRegions(sf::Texture& minimap_texture);
+
+private:
+    struct PixelRect {
+        int x = 0;
+        int y = 0;
+        int width = 0;
+        int height = 0;
+    };
+
+    // A region to rebuild plus a private copy of the pyramid texels under its footprint
+    struct PendingRegion {
+        PixelRect rect;
+        int texel_x = 0;      // First texel column, in pyramid_level texels
+        int texel_y = 0;
+        int texel_width = 0;
+        int texel_height = 0;
+        std::vector<sf::Color> texels; // Row-major, texel_width x texel_height
+    };
+
+    struct FinishedRegion {
+        PixelRect rect;
+        std::vector<sf::Uint8> pixels; // RGBA8, rect.width x rect.height
+    };
+
+    const World::Map* map = nullptr; // Read on the calling thread only, never by the worker
+    int map_width = 0;
+    int map_height = 0;
+    int width_px = 0;
+    int height_px = 0;
+    int pyramid_level = 0;           // Finest level whose texels still fit inside one pixel's footprint
+
+    std::thread worker;
+    std::mutex queue_mutex;
+    std::condition_variable queue_wake;
+    std::vector<PendingRegion> pending_regions;   // Guarded by queue_mutex
+    std::vector<FinishedRegion> finished_regions; // Guarded by queue_mutex
+    bool stopping = false;                        // Guarded by queue_mutex
+
+    void queueRegion(const PixelRect& rect);
+    void captureTexels(PendingRegion& pending) const;
+    void workerLoop();
+    void buildRegion(const PendingRegion& pending, FinishedRegion& region) const;
+    void pixelFootprint(int pixel_x, int pixel_y, int& tile_x0, int& tile_y0, int& tile_x1, int& tile_y1) const;
+    sf::Color samplePixel(const PendingRegion& pending, int pixel_x, int pixel_y) const;
+};
+
+} // namespace Core
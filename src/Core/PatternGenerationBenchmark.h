@@ -0,0 +1,17 @@
+// File: EmergentKingdoms/src/Core/PatternGenerationBenchmark.h
+#pragma once
+
+#include <ostream>
+
+namespace Core {
+
+/**
+ * Multi-tile object pattern benchmark (--benchmark-patterns [seed]). First times
+ * the per-tile noise primitives against the per-call mt19937 seeding they
+ * replaced, then regenerates the atlas variant set from
+ * VegetationObjectManager::createPatternPrototypes
+ * BENCHMARK_PATTERN_ROUNDS times on one thread. Needs no world and no window.
+ */
+void runPatternGenerationBenchmark(unsigned int seed, std::ostream& out);
+
+} // namespace Core
@@ -2,10 +2,12 @@
 #include "Renderer.h"
 #include <iostream>
 #include <cmath> 
+#include <algorithm>
 
 namespace Core {
 
 Renderer::Renderer() : 
+    target_window(nullptr),
     font_texture_atlas(nullptr),
     current_sfml_font_size_internal(0),
     current_char_cell_width_px_internal(0),
@@ -13,21 +15,28 @@ Renderer::Renderer() :
     current_screen_width_chars_internal(0),
     current_screen_height_chars_internal(0)
 {
-    background_vertices.setPrimitiveType(sf::Quads);
-    foreground_vertices.setPrimitiveType(sf::Quads);
+    background_buffer.setPrimitiveType(sf::Quads);
+    foreground_buffer.setPrimitiveType(sf::Quads);
+    background_buffer.setUsage(sf::VertexBuffer::Stream);
+    foreground_buffer.setUsage(sf::VertexBuffer::Stream);
 }
 
 Renderer::~Renderer() {
 }
 
 bool Renderer::initialize(sf::RenderWindow& window, unsigned int initial_sfml_font_size) {
-    (void)window;
+    target_window = &window;
     if (!font.loadFromFile(FONT_PATH)) {
         std::cerr << "Renderer::initialize() - ERROR: Could not load font from " << FONT_PATH << std::endl;
         return false;
     }
     current_sfml_font_size_internal = initial_sfml_font_size; 
     font_texture_atlas = &font.getTexture(current_sfml_font_size_internal);
+
+    use_vertex_buffers = sf::VertexBuffer::isAvailable();
+    if (!use_vertex_buffers) {
+        std::cout << "  Renderer: vertex buffers unavailable, drawing from client-side vertex arrays." << std::endl;
+    }
     
     initialized = true;
     return true;
@@ -39,6 +48,8 @@ void Renderer::updateLayout(unsigned int new_sfml_font_size,
     if (!initialized) return;
 
     bool font_size_changed = (current_sfml_font_size_internal != new_sfml_font_size);
+    bool cell_size_changed = (current_char_cell_width_px_internal != new_char_cell_width_px ||
+                              current_char_cell_height_px_internal != new_char_cell_height_px);
     current_sfml_font_size_internal = new_sfml_font_size;
     current_char_cell_width_px_internal = new_char_cell_width_px;
     current_char_cell_height_px_internal = new_char_cell_height_px;
@@ -50,6 +61,9 @@ void Renderer::updateLayout(unsigned int new_sfml_font_size,
     if (font_size_changed && font.getInfo().family != "") { 
          font_texture_atlas = &font.getTexture(current_sfml_font_size_internal);
     }
+    if (font_size_changed || cell_size_changed || !glyph_table_valid) {
+        rebuildGlyphTable();
+    }
     
     size_t buffer_size = static_cast<size_t>(current_screen_width_chars_internal) * current_screen_height_chars_internal;
     if (buffer_size > 0) { 
@@ -57,16 +71,47 @@ void Renderer::updateLayout(unsigned int new_sfml_font_size,
     } else {
         next_buffer.clear(); 
     }
+    previous_buffer.assign(next_buffer.size(), ScreenCell());
+    dirty_cells.assign(next_buffer.size(), 0);
+    background_slots.resize(next_buffer.size() * 4);
+    foreground_slots.resize(next_buffer.size() * 4);
+    slots_invalidated = true;
     prepareFrame(); 
 }
 
 
+void Renderer::rebuildGlyphTable() {
+    float cell_width_float = static_cast<float>(current_char_cell_width_px_internal);
+    float cell_height_float = static_cast<float>(current_char_cell_height_px_internal);
+
+    for (size_t code = 0; code < glyph_table.size(); ++code) {
+        GlyphMetrics& metrics = glyph_table[code];
+        metrics = GlyphMetrics();
+
+        // Same code point the per-cell lookup used: the cell's char, promoted with its sign
+        char character = static_cast<char>(code);
+        if (character == ' ' || character == '\0') continue;
+
+        const sf::Glyph& glyph = font.getGlyph(character, current_sfml_font_size_internal, false);
+        if (glyph.textureRect.width <= 0 || glyph.textureRect.height <= 0) continue;
+
+        metrics.drawable = true;
+        metrics.width = static_cast<float>(glyph.textureRect.width);
+        metrics.height = static_cast<float>(glyph.textureRect.height);
+        metrics.offset_x = (cell_width_float - metrics.width) / 2.0f;
+        metrics.offset_y = (cell_height_float - metrics.height) / 2.0f;
+        metrics.u1 = static_cast<float>(glyph.textureRect.left);
+        metrics.v1 = static_cast<float>(glyph.textureRect.top);
+        metrics.u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width);
+        metrics.v2 = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height);
+    }
+    glyph_table_valid = true;
+}
+
 void Renderer::prepareFrame() {
     if (!initialized || next_buffer.empty()) return;
     ScreenCell empty_cell(' ', Colors::WHITE, Colors::DEFAULT_BG); 
-    for (size_t i = 0; i < next_buffer.size(); ++i) {
-        next_buffer[i] = empty_cell;
-    }
+    std::fill(next_buffer.begin(), next_buffer.end(), empty_cell);
 }
 
 void Renderer::setCell(int x, int y, char character, const sf::Color& fg_color, const sf::Color& bg_color) {
@@ -87,73 +132,148 @@ void Renderer::setCell(int x, int y, const ScreenCell& cell) {
     }
 }
 
-void Renderer::render(sf::RenderWindow& window, float pixel_shift_x, float pixel_shift_y) {
-    if (!initialized || next_buffer.empty() || font_texture_atlas == nullptr ||
-        current_char_cell_width_px_internal <= 0 || current_char_cell_height_px_internal <=0) {
-        return; 
+bool Renderer::canRender() const {
+    return initialized && target_window != nullptr && !next_buffer.empty() && font_texture_atlas != nullptr &&
+           current_char_cell_width_px_internal > 0 && current_char_cell_height_px_internal > 0;
+}
+
+void Renderer::buildFrame() {
+    if (!canRender()) return;
+    if (slots_invalidated) {
+        rebuildAllSlots();
+    } else {
+        updateDirtySlots();
     }
+}
 
-    background_vertices.clear(); 
-    foreground_vertices.clear(); 
+void Renderer::present(float pixel_shift_x, float pixel_shift_y) {
+    if (!canRender()) return;
+    sf::RenderWindow& window = *target_window;
 
-    float cell_width_float = static_cast<float>(current_char_cell_width_px_internal);
-    float cell_height_float = static_cast<float>(current_char_cell_height_px_internal);
+    // Slots are laid out on the unshifted grid, so sub-cell scrolling only moves the transform
+    sf::RenderStates background_states;
+    background_states.transform.translate(pixel_shift_x, pixel_shift_y);
+    sf::RenderStates foreground_states = background_states;
+    foreground_states.texture = font_texture_atlas;
 
+    if (use_vertex_buffers) {
+        window.draw(background_buffer, background_states);
+        window.draw(foreground_buffer, foreground_states);
+    } else {
+        window.draw(background_slots.data(), background_slots.size(), sf::Quads, background_states);
+        window.draw(foreground_slots.data(), foreground_slots.size(), sf::Quads, foreground_states);
+    }
+}
 
+void Renderer::rebuildAllSlots() {
+    // Every cell owns fixed slots, so row bands are written in parallel without sharing
+    #pragma omp parallel for schedule(static)
     for (int y_char_grid = 0; y_char_grid < current_screen_height_chars_internal; ++y_char_grid) {
-        for (int x_char_grid = 0; x_char_grid < current_screen_width_chars_internal; ++x_char_grid) {
-            size_t buffer_idx = static_cast<size_t>(y_char_grid) * current_screen_width_chars_internal + x_char_grid;
-            
-            const ScreenCell& cell_to_draw = next_buffer[buffer_idx];
-
-            float grid_pos_x = static_cast<float>(x_char_grid * current_char_cell_width_px_internal);
-            float grid_pos_y = static_cast<float>(y_char_grid * current_char_cell_height_px_internal);
-            
-            float final_pos_x = grid_pos_x + pixel_shift_x;
-            float final_pos_y = grid_pos_y + pixel_shift_y;
-
-            background_vertices.append(sf::Vertex(sf::Vector2f(final_pos_x, final_pos_y), cell_to_draw.bg_color));
-            background_vertices.append(sf::Vertex(sf::Vector2f(final_pos_x + cell_width_float, final_pos_y), cell_to_draw.bg_color));
-            background_vertices.append(sf::Vertex(sf::Vector2f(final_pos_x + cell_width_float, final_pos_y + cell_height_float), cell_to_draw.bg_color));
-            background_vertices.append(sf::Vertex(sf::Vector2f(final_pos_x, final_pos_y + cell_height_float), cell_to_draw.bg_color));
-
-            if (cell_to_draw.character != ' ' && cell_to_draw.character != '\0') {
-                sf::Glyph glyph = font.getGlyph(cell_to_draw.character, current_sfml_font_size_internal, false); 
-
-                if (glyph.textureRect.width > 0 && glyph.textureRect.height > 0) {
-                    float u1 = static_cast<float>(glyph.textureRect.left);
-                    float v1 = static_cast<float>(glyph.textureRect.top);
-                    float u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width);
-                    float v2 = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height);
-                    
-                    float char_offset_x = (cell_width_float - static_cast<float>(glyph.textureRect.width)) / 2.0f;
-                    float char_render_pos_x = final_pos_x + char_offset_x;
-
-                    float char_offset_y = (cell_height_float - static_cast<float>(glyph.textureRect.height)) / 2.0f;
-                    float char_render_pos_y = final_pos_y + char_offset_y;
-
-                    // Removed unused line_spacing variable and commented out alternatives
-                    // float line_spacing = font.getLineSpacing(current_sfml_font_size_internal);
-
-                    foreground_vertices.append(sf::Vertex(sf::Vector2f(char_render_pos_x, char_render_pos_y), cell_to_draw.fg_color, sf::Vector2f(u1, v1)));
-                    foreground_vertices.append(sf::Vertex(sf::Vector2f(char_render_pos_x + glyph.textureRect.width, char_render_pos_y), cell_to_draw.fg_color, sf::Vector2f(u2, v1)));
-                    foreground_vertices.append(sf::Vertex(sf::Vector2f(char_render_pos_x + glyph.textureRect.width, char_render_pos_y + glyph.textureRect.height), cell_to_draw.fg_color, sf::Vector2f(u2, v2)));
-                    foreground_vertices.append(sf::Vertex(sf::Vector2f(char_render_pos_x, char_render_pos_y + glyph.textureRect.height), cell_to_draw.fg_color, sf::Vector2f(u1, v2)));
-                }
+        size_t row_begin = static_cast<size_t>(y_char_grid) * current_screen_width_chars_internal;
+        for (size_t buffer_idx = row_begin; buffer_idx < row_begin + current_screen_width_chars_internal; ++buffer_idx) {
+            writeCellVertices(buffer_idx);
+        }
+    }
+    previous_buffer = next_buffer;
+
+    if (use_vertex_buffers) {
+        if (background_buffer.getVertexCount() != background_slots.size()) {
+            if (!background_buffer.create(background_slots.size()) ||
+                !foreground_buffer.create(foreground_slots.size())) {
+                std::cerr << "Renderer::rebuildAllSlots() - ERROR: Could not create vertex buffers, "
+                          << "falling back to vertex arrays." << std::endl;
+                use_vertex_buffers = false;
             }
         }
+        if (use_vertex_buffers) {
+            uploadSlotRange(0, next_buffer.size());
+        }
     }
-    
-    if (background_vertices.getVertexCount() > 0) {
-        window.draw(background_vertices);
+    slots_invalidated = false;
+}
+
+void Renderer::updateDirtySlots() {
+    // Diff and rewrite changed cells in parallel row bands; each cell touches only its own slots
+    #pragma omp parallel for schedule(static)
+    for (int y_char_grid = 0; y_char_grid < current_screen_height_chars_internal; ++y_char_grid) {
+        size_t row_begin = static_cast<size_t>(y_char_grid) * current_screen_width_chars_internal;
+        for (size_t buffer_idx = row_begin; buffer_idx < row_begin + current_screen_width_chars_internal; ++buffer_idx) {
+            if (next_buffer[buffer_idx] == previous_buffer[buffer_idx]) {
+                dirty_cells[buffer_idx] = 0;
+                continue;
+            }
+            previous_buffer[buffer_idx] = next_buffer[buffer_idx];
+            writeCellVertices(buffer_idx);
+            dirty_cells[buffer_idx] = 1;
+        }
+    }
+
+    // Upload the changed cells as contiguous ranges; nearby changes (e.g. scattered water
+    // cells) share one range
+    const size_t merge_gap = static_cast<size_t>(RENDERER_DIRTY_RUN_MERGE_GAP_CELLS);
+    bool run_open = false;
+    size_t run_start = 0;
+    size_t run_end = 0;
+
+    for (size_t buffer_idx = 0; buffer_idx < dirty_cells.size(); ++buffer_idx) {
+        if (!dirty_cells[buffer_idx]) continue;
+
+        if (run_open && buffer_idx - run_end <= merge_gap) {
+            run_end = buffer_idx + 1;
+        } else {
+            if (run_open) uploadSlotRange(run_start, run_end);
+            run_start = buffer_idx;
+            run_end = buffer_idx + 1;
+            run_open = true;
+        }
     }
-    if (font_texture_atlas && foreground_vertices.getVertexCount() > 0) { 
-        sf::RenderStates states;
-        states.texture = font_texture_atlas;
-        window.draw(foreground_vertices, states);
+    if (run_open) uploadSlotRange(run_start, run_end);
+}
+
+void Renderer::writeCellVertices(size_t buffer_idx) {
+    const ScreenCell& cell_to_draw = next_buffer[buffer_idx];
+    int x_char_grid = static_cast<int>(buffer_idx % static_cast<size_t>(current_screen_width_chars_internal));
+    int y_char_grid = static_cast<int>(buffer_idx / static_cast<size_t>(current_screen_width_chars_internal));
+
+    float cell_width_float = static_cast<float>(current_char_cell_width_px_internal);
+    float cell_height_float = static_cast<float>(current_char_cell_height_px_internal);
+    float pos_x = static_cast<float>(x_char_grid * current_char_cell_width_px_internal);
+    float pos_y = static_cast<float>(y_char_grid * current_char_cell_height_px_internal);
+
+    sf::Vertex* background_quad = &background_slots[buffer_idx * 4];
+    background_quad[0] = sf::Vertex(sf::Vector2f(pos_x, pos_y), cell_to_draw.bg_color);
+    background_quad[1] = sf::Vertex(sf::Vector2f(pos_x + cell_width_float, pos_y), cell_to_draw.bg_color);
+    background_quad[2] = sf::Vertex(sf::Vector2f(pos_x + cell_width_float, pos_y + cell_height_float), cell_to_draw.bg_color);
+    background_quad[3] = sf::Vertex(sf::Vector2f(pos_x, pos_y + cell_height_float), cell_to_draw.bg_color);
+
+    sf::Vertex* foreground_quad = &foreground_slots[buffer_idx * 4];
+    const GlyphMetrics& glyph = glyph_table[static_cast<unsigned char>(cell_to_draw.character)];
+    if (glyph.drawable) {
+        float char_render_pos_x = pos_x + glyph.offset_x;
+        float char_render_pos_y = pos_y + glyph.offset_y;
+
+        foreground_quad[0] = sf::Vertex(sf::Vector2f(char_render_pos_x, char_render_pos_y), cell_to_draw.fg_color, sf::Vector2f(glyph.u1, glyph.v1));
+        foreground_quad[1] = sf::Vertex(sf::Vector2f(char_render_pos_x + glyph.width, char_render_pos_y), cell_to_draw.fg_color, sf::Vector2f(glyph.u2, glyph.v1));
+        foreground_quad[2] = sf::Vertex(sf::Vector2f(char_render_pos_x + glyph.width, char_render_pos_y + glyph.height), cell_to_draw.fg_color, sf::Vector2f(glyph.u2, glyph.v2));
+        foreground_quad[3] = sf::Vertex(sf::Vector2f(char_render_pos_x, char_render_pos_y + glyph.height), cell_to_draw.fg_color, sf::Vector2f(glyph.u1, glyph.v2));
+        return;
+    }
+
+    // No glyph: collapse the slot to a zero-area quad so it rasterizes nothing
+    sf::Vertex empty_vertex(sf::Vector2f(pos_x, pos_y), sf::Color::Transparent);
+    for (int corner = 0; corner < 4; ++corner) {
+        foreground_quad[corner] = empty_vertex;
     }
 }
 
+void Renderer::uploadSlotRange(size_t first_cell, size_t end_cell) {
+    if (!use_vertex_buffers || end_cell <= first_cell) return;
+    size_t first_vertex = first_cell * 4;
+    size_t vertex_count = (end_cell - first_cell) * 4;
+    background_buffer.update(&background_slots[first_vertex], vertex_count, static_cast<unsigned int>(first_vertex));
+    foreground_buffer.update(&foreground_slots[first_vertex], vertex_count, static_cast<unsigned int>(first_vertex));
+}
+
 void Renderer::shutdown() {
     initialized = false;
 }
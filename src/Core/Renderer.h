@@ -2,49 +2,72 @@
 #pragma once
 
 #include <vector>
+#include <array>
 #include <string>
 #include <SFML/Graphics.hpp>
 #include "BaseConfig.h"
+#include "ScreenCell.h"
+#include "IRenderBackend.h"
 
 namespace Core {
 
-struct ScreenCell {
-    char character = ' ';
-    sf::Color fg_color = Colors::WHITE;
-    sf::Color bg_color = Colors::BLACK; 
-
-    ScreenCell() = default;
-    ScreenCell(char ch, const sf::Color& fg = Colors::WHITE, const sf::Color& bg = Colors::BLACK)
-        : character(ch), fg_color(fg), bg_color(bg) {}
-};
-
-class Renderer {
+// SFML backend: the cell grid as two vertex layers drawn into the window
+class Renderer : public IRenderBackend {
 public:
     Renderer();
     ~Renderer();
 
+    // The window is kept as the target of present()
     bool initialize(sf::RenderWindow& window, unsigned int initial_sfml_font_size);
     void updateLayout(unsigned int new_sfml_font_size, 
                       int new_char_cell_width_px, int new_char_cell_height_px,
-                      int new_screen_width_chars, int new_screen_height_chars);
-    void prepareFrame();
+                      int new_screen_width_chars, int new_screen_height_chars) override;
+    void prepareFrame() override;
     void setCell(int x, int y, char character, const sf::Color& fg_color = Colors::WHITE, const sf::Color& bg_color = Colors::BLACK);
-    void setCell(int x, int y, const ScreenCell& cell);
-    // MODIFIED: Reinstated pixel_shift parameters
-    void render(sf::RenderWindow& window, float pixel_shift_x = 0.0f, float pixel_shift_y = 0.0f); 
-    void shutdown();
-    bool isInitialized() const { return initialized; }
+    void setCell(int x, int y, const ScreenCell& cell) override;
+    void buildFrame() override;                                    // Rewrite and upload changed vertex slots
+    void present(float pixel_shift_x, float pixel_shift_y) override; // Draw both layers into the window
+    void shutdown() override;
+    bool isInitialized() const override { return initialized; }
+    const sf::Font& getFont() const { return font; }
 
 
 private:
-    sf::Font font;
+    // Cached glyph placement for one 8-bit character at the current font and cell size
+    struct GlyphMetrics {
+        bool drawable = false;   // False for blanks and glyphs without pixels
+        float offset_x = 0.0f;   // Top-left of the glyph quad relative to its cell
+        float offset_y = 0.0f;
+        float width = 0.0f;
+        float height = 0.0f;
+        float u1 = 0.0f, v1 = 0.0f, u2 = 0.0f, v2 = 0.0f;
+    };
 
-    sf::VertexArray background_vertices;
-    sf::VertexArray foreground_vertices;
+    sf::RenderWindow* target_window;
+    sf::Font font;
     const sf::Texture* font_texture_atlas;
-
+    std::array<GlyphMetrics, 256> glyph_table; // Indexed by the cell character as unsigned char
+    bool glyph_table_valid = false;
 
     std::vector<ScreenCell> next_buffer;
+    std::vector<ScreenCell> previous_buffer; // What the vertex slots currently hold
+    std::vector<unsigned char> dirty_cells;  // Cells rewritten this frame, uploaded as merged ranges
+
+    // Fixed slots: cell i owns vertices [4*i, 4*i + 4) in both layers, positioned at
+    // its grid cell without the pixel shift (applied as a draw transform instead)
+    std::vector<sf::Vertex> background_slots;
+    std::vector<sf::Vertex> foreground_slots;
+    sf::VertexBuffer background_buffer;
+    sf::VertexBuffer foreground_buffer;
+    bool use_vertex_buffers = false;
+    bool slots_invalidated = true; // Layout changed; every slot must be rewritten and uploaded
+
+    bool canRender() const;
+    void rebuildGlyphTable();
+    void rebuildAllSlots();
+    void updateDirtySlots();
+    void writeCellVertices(size_t buffer_idx);
+    void uploadSlotRange(size_t first_cell, size_t end_cell);
 
     unsigned int current_sfml_font_size_internal;
     int current_char_cell_width_px_internal;
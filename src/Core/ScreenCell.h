@@ -0,0 +1,24 @@
+// File: EmergentKingdoms/src/Core/ScreenCell.h
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include "BaseConfig.h"
+
+namespace Core {
+
+struct ScreenCell {
+    char character = ' ';
+    sf::Color fg_color = Colors::WHITE;
+    sf::Color bg_color = Colors::BLACK; 
+
+    ScreenCell() = default;
+    ScreenCell(char ch, const sf::Color& fg = Colors::WHITE, const sf::Color& bg = Colors::BLACK)
+        : character(ch), fg_color(fg), bg_color(bg) {}
+
+    bool operator==(const ScreenCell& other) const {
+        return character == other.character && fg_color == other.fg_color && bg_color == other.bg_color;
+    }
+    bool operator!=(const ScreenCell& other) const { return !(*this == other); }
+};
+
+} // namespace Core
@@ -0,0 +1,48 @@
+// File: EmergentKingdoms/src/Core/SimulationThread.cpp
+#include "SimulationThread.h"
+#include <iostream>
+
+namespace Core {
+
+SimulationThread::~SimulationThread() {
+    stop();
+}
+
+void SimulationThread::start(TickFunction tick, sf::Time length) {
+    stop();
+    tick_function = std::move(tick);
+    tick_length = length;
+    running.store(true, std::memory_order_release);
+    worker = std::thread(&SimulationThread::run, this);
+    std::cout << "Simulation thread started (" << tick_length.asMicroseconds() << " us per tick)." << std::endl;
+}
+
+void SimulationThread::stop() {
+    running.store(false, std::memory_order_release);
+    if (worker.joinable()) {
+        worker.join();
+    }
+}
+
+void SimulationThread::run() {
+    sf::Clock tick_clock;
+    sf::Time time_since_last_tick = sf::Time::Zero;
+
+    while (running.load(std::memory_order_acquire)) {
+        time_since_last_tick += tick_clock.restart();
+
+        int ticks_this_pass = 0;
+        while (time_since_last_tick >= tick_length && ticks_this_pass < MAX_CATCH_UP_TICKS) {
+            time_since_last_tick -= tick_length;
+            tick_function(tick_length);
+            ++ticks_this_pass;
+        }
+        if (time_since_last_tick >= tick_length) {
+            time_since_last_tick = sf::Time::Zero; // Too far behind: drop the backlog
+        }
+
+        sf::sleep(tick_length - time_since_last_tick);
+    }
+}
+
+} // namespace Core
@@ -0,0 +1,41 @@
+// File: EmergentKingdoms/src/Core/SimulationThread.h
+#pragma once
+
+#include <thread>
+#include <atomic>
+#include <functional>
+#include <SFML/System.hpp>
+
+namespace Core {
+
+/**
+ * Runs a fixed-step tick function on its own thread at a constant rate.
+ * If the thread falls behind it runs at most MAX_CATCH_UP_TICKS ticks in a
+ * row and then drops the remaining backlog rather than spiralling.
+ */
+class SimulationThread {
+public:
+    using TickFunction = std::function<void(sf::Time)>;
+
+    SimulationThread() = default;
+    ~SimulationThread();
+
+    SimulationThread(const SimulationThread&) = delete;
+    SimulationThread& operator=(const SimulationThread&) = delete;
+
+    void start(TickFunction tick, sf::Time tick_length);
+    void stop();
+    bool isRunning() const { return running.load(std::memory_order_acquire); }
+
+private:
+    static constexpr int MAX_CATCH_UP_TICKS = 5;
+
+    std::thread worker;
+    std::atomic<bool> running{false};
+    TickFunction tick_function;
+    sf::Time tick_length;
+
+    void run();
+};
+
+} // namespace Core
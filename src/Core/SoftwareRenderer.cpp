@@ -0,0 +1,314 @@
+// File: EmergentKingdoms/src/Core/SoftwareRenderer.cpp
+#include "SoftwareRenderer.h"
+#include <iostream>
+#include <cmath>
+#include <algorithm>
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+namespace Core {
+
+namespace {
+
+// Pixel p is covered by a quad edge range [edge_min, edge_max) when its centre p + 0.5 is
+// inside it (same rule as the GL rasteriser), so the covered pixels are [first, end)
+inline int firstCoveredPixel(float edge) {
+    return static_cast<int>(std::ceil(edge - 0.5f));
+}
+
+// sf::BlendAlpha for one RGBA8 pixel
+inline void blendPixel(std::uint8_t* dst, const sf::Color& src, unsigned int src_alpha) {
+    if (src_alpha == 0) return;
+    if (src_alpha >= 255) {
+        dst[0] = src.r;
+        dst[1] = src.g;
+        dst[2] = src.b;
+        dst[3] = 255;
+        return;
+    }
+    unsigned int inv_alpha = 255 - src_alpha;
+    dst[0] = static_cast<std::uint8_t>((src.r * src_alpha + dst[0] * inv_alpha + 127) / 255);
+    dst[1] = static_cast<std::uint8_t>((src.g * src_alpha + dst[1] * inv_alpha + 127) / 255);
+    dst[2] = static_cast<std::uint8_t>((src.b * src_alpha + dst[2] * inv_alpha + 127) / 255);
+    dst[3] = static_cast<std::uint8_t>(src_alpha + (dst[3] * inv_alpha + 127) / 255);
+}
+
+} // anonymous namespace
+
+SoftwareRenderer::SoftwareRenderer() :
+    ft_library(nullptr),
+    ft_face(nullptr),
+    glyph_atlas_width(0),
+    glyph_slot_width(0),
+    glyph_slot_height(0),
+    target_width_px_internal(0),
+    target_height_px_internal(0),
+    current_sfml_font_size_internal(0),
+    current_char_cell_width_px_internal(0),
+    current_char_cell_height_px_internal(0),
+    current_screen_width_chars_internal(0),
+    current_screen_height_chars_internal(0)
+{
+}
+
+SoftwareRenderer::~SoftwareRenderer() {
+    shutdown();
+}
+
+bool SoftwareRenderer::initialize(int target_width_px, int target_height_px, unsigned int initial_sfml_font_size) {
+    if (target_width_px <= 0 || target_height_px <= 0) {
+        std::cerr << "SoftwareRenderer::initialize() - ERROR: Invalid target size "
+                  << target_width_px << "x" << target_height_px << std::endl;
+        return false;
+    }
+    if (FT_Init_FreeType(&ft_library) != 0) {
+        std::cerr << "SoftwareRenderer::initialize() - ERROR: Could not initialize FreeType" << std::endl;
+        ft_library = nullptr;
+        return false;
+    }
+    if (FT_New_Face(ft_library, FONT_PATH.c_str(), 0, &ft_face) != 0) {
+        std::cerr << "SoftwareRenderer::initialize() - ERROR: Could not load font from " << FONT_PATH << std::endl;
+        ft_face = nullptr;
+        shutdown();
+        return false;
+    }
+    // sf::Font looks characters up as Unicode code points
+    FT_Select_Charmap(ft_face, FT_ENCODING_UNICODE);
+
+    target_width_px_internal = target_width_px;
+    target_height_px_internal = target_height_px;
+    pixels.assign(static_cast<size_t>(target_width_px) * target_height_px * 4, 0);
+
+    current_sfml_font_size_internal = initial_sfml_font_size;
+    initialized = true;
+    rebuildGlyphAtlas();
+    return true;
+}
+
+void SoftwareRenderer::updateLayout(unsigned int new_sfml_font_size,
+                                    int new_char_cell_width_px, int new_char_cell_height_px,
+                                    int new_screen_width_chars, int new_screen_height_chars) {
+    if (!initialized) return;
+
+    bool font_size_changed = (current_sfml_font_size_internal != new_sfml_font_size);
+    current_sfml_font_size_internal = new_sfml_font_size;
+    current_char_cell_width_px_internal = new_char_cell_width_px;
+    current_char_cell_height_px_internal = new_char_cell_height_px;
+
+    // Same +2 margin as Renderer so callers can drive both backends identically
+    current_screen_width_chars_internal = new_screen_width_chars + 2;
+    current_screen_height_chars_internal = new_screen_height_chars + 2;
+
+    if (font_size_changed) {
+        rebuildGlyphAtlas();
+    }
+
+    size_t buffer_size = static_cast<size_t>(current_screen_width_chars_internal) * current_screen_height_chars_internal;
+    if (buffer_size > 0) {
+        next_buffer.resize(buffer_size);
+    } else {
+        next_buffer.clear();
+    }
+    prepareFrame();
+}
+
+void SoftwareRenderer::rebuildGlyphAtlas() {
+    glyph_table.fill(AtlasGlyph());
+    glyph_atlas.clear();
+    glyph_atlas_width = 0;
+    glyph_slot_width = 0;
+    glyph_slot_height = 0;
+    if (ft_face == nullptr || current_sfml_font_size_internal == 0) return;
+
+    if (FT_Set_Pixel_Sizes(ft_face, 0, current_sfml_font_size_internal) != 0) {
+        std::cerr << "SoftwareRenderer::rebuildGlyphAtlas() - ERROR: Font size "
+                  << current_sfml_font_size_internal << " not supported" << std::endl;
+        return;
+    }
+
+    // Rasterise every character first to size the atlas slots
+    std::array<std::vector<std::uint8_t>, 256> coverage;
+    for (size_t code = 0; code < glyph_table.size(); ++code) {
+        // Same code point the SFML path asks for: the cell's char, promoted with its sign
+        char character = static_cast<char>(code);
+        if (character == ' ' || character == '\0') continue;
+
+        // Load flags match sf::Font::loadGlyph for a regular, non-outlined glyph
+        FT_UInt32 code_point = static_cast<FT_UInt32>(static_cast<sf::Uint32>(character));
+        if (FT_Load_Char(ft_face, code_point, FT_LOAD_TARGET_NORMAL | FT_LOAD_FORCE_AUTOHINT) != 0) continue;
+        if (FT_Render_Glyph(ft_face->glyph, FT_RENDER_MODE_NORMAL) != 0) continue;
+
+        const FT_Bitmap& bitmap = ft_face->glyph->bitmap;
+        int width = static_cast<int>(bitmap.width);
+        int height = static_cast<int>(bitmap.rows);
+        if (width <= 0 || height <= 0) continue;
+
+        std::vector<std::uint8_t>& glyph_coverage = coverage[code];
+        glyph_coverage.resize(static_cast<size_t>(width) * height);
+        for (int row = 0; row < height; ++row) {
+            const unsigned char* src_row = bitmap.buffer + row * bitmap.pitch;
+            for (int col = 0; col < width; ++col) {
+                std::uint8_t value;
+                if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO) {
+                    value = ((src_row[col / 8] >> (7 - (col % 8))) & 1) ? 255 : 0;
+                } else {
+                    value = src_row[col];
+                }
+                glyph_coverage[static_cast<size_t>(row) * width + col] = value;
+            }
+        }
+        glyph_table[code].width = width;
+        glyph_table[code].height = height;
+        glyph_slot_width = std::max(glyph_slot_width, width);
+        glyph_slot_height = std::max(glyph_slot_height, height);
+    }
+    if (glyph_slot_width == 0 || glyph_slot_height == 0) return;
+
+    // Pack into a 16x16 grid of equal slots
+    glyph_atlas_width = glyph_slot_width * 16;
+    glyph_atlas.assign(static_cast<size_t>(glyph_atlas_width) * glyph_slot_height * 16, 0);
+    for (size_t code = 0; code < glyph_table.size(); ++code) {
+        AtlasGlyph& glyph = glyph_table[code];
+        if (glyph.width == 0) continue;
+        glyph.atlas_x = static_cast<int>(code % 16) * glyph_slot_width;
+        glyph.atlas_y = static_cast<int>(code / 16) * glyph_slot_height;
+        for (int row = 0; row < glyph.height; ++row) {
+            std::copy_n(&coverage[code][static_cast<size_t>(row) * glyph.width], glyph.width,
+                        &glyph_atlas[static_cast<size_t>(glyph.atlas_y + row) * glyph_atlas_width + glyph.atlas_x]);
+        }
+    }
+}
+
+void SoftwareRenderer::prepareFrame() {
+    if (!initialized || next_buffer.empty()) return;
+    ScreenCell empty_cell(' ', Colors::WHITE, Colors::DEFAULT_BG);
+    std::fill(next_buffer.begin(), next_buffer.end(), empty_cell);
+}
+
+void SoftwareRenderer::setCell(int x, int y, char character, const sf::Color& fg_color, const sf::Color& bg_color) {
+    if (!initialized || next_buffer.empty()) return;
+    if (x >= 0 && x < current_screen_width_chars_internal && y >= 0 && y < current_screen_height_chars_internal) {
+        size_t index = static_cast<size_t>(y) * current_screen_width_chars_internal + x;
+        next_buffer[index].character = character;
+        next_buffer[index].fg_color = fg_color;
+        next_buffer[index].bg_color = bg_color;
+    }
+}
+
+void SoftwareRenderer::setCell(int x, int y, const ScreenCell& cell) {
+    if (!initialized || next_buffer.empty()) return;
+    if (x >= 0 && x < current_screen_width_chars_internal && y >= 0 && y < current_screen_height_chars_internal) {
+        size_t index = static_cast<size_t>(y) * current_screen_width_chars_internal + x;
+        next_buffer[index] = cell;
+    }
+}
+
+void SoftwareRenderer::present(float pixel_shift_x, float pixel_shift_y) {
+    if (!initialized || pixels.empty()) return;
+
+    // Output rows are independent (each row composites every quad that covers it in
+    // draw order), so they are split across threads without any shared writes
+    #pragma omp parallel for schedule(static)
+    for (int pixel_y = 0; pixel_y < target_height_px_internal; ++pixel_y) {
+        rasterizeRow(pixel_y, pixel_shift_x, pixel_shift_y);
+    }
+}
+
+void SoftwareRenderer::rasterizeRow(int pixel_y, float pixel_shift_x, float pixel_shift_y) {
+    std::uint8_t* row_pixels = &pixels[static_cast<size_t>(pixel_y) * target_width_px_internal * 4];
+
+    // Window clear colour, as Game::render clears before drawing the grid
+    for (int pixel_x = 0; pixel_x < target_width_px_internal; ++pixel_x) {
+        std::uint8_t* dst = &row_pixels[pixel_x * 4];
+        dst[0] = Colors::DEFAULT_BG.r;
+        dst[1] = Colors::DEFAULT_BG.g;
+        dst[2] = Colors::DEFAULT_BG.b;
+        dst[3] = Colors::DEFAULT_BG.a;
+    }
+    if (next_buffer.empty() || current_char_cell_width_px_internal <= 0 || current_char_cell_height_px_internal <= 0) {
+        return;
+    }
+
+    float cell_width_float = static_cast<float>(current_char_cell_width_px_internal);
+    float cell_height_float = static_cast<float>(current_char_cell_height_px_internal);
+    float sample_y = static_cast<float>(pixel_y) + 0.5f - pixel_shift_y; // Pixel centre in grid space
+
+    // ===== BACKGROUND PASS =====
+    int cell_y = static_cast<int>(std::floor(sample_y / cell_height_float));
+    if (cell_y >= 0 && cell_y < current_screen_height_chars_internal) {
+        const ScreenCell* cell_row = &next_buffer[static_cast<size_t>(cell_y) * current_screen_width_chars_internal];
+        for (int cell_x = 0; cell_x < current_screen_width_chars_internal; ++cell_x) {
+            float left = cell_x * cell_width_float + pixel_shift_x;
+            int span_begin = std::max(0, firstCoveredPixel(left));
+            int span_end = std::min(target_width_px_internal, firstCoveredPixel(left + cell_width_float));
+            const sf::Color& bg_color = cell_row[cell_x].bg_color;
+            for (int pixel_x = span_begin; pixel_x < span_end; ++pixel_x) {
+                blendPixel(&row_pixels[pixel_x * 4], bg_color, bg_color.a);
+            }
+        }
+    }
+
+    // ===== GLYPH PASS =====
+    if (glyph_slot_height == 0) return;
+
+    // Glyphs can be taller than their cell, so check every cell row whose centred glyph could reach here
+    int first_cell_y = static_cast<int>(std::floor((sample_y - glyph_slot_height) / cell_height_float));
+    int last_cell_y = static_cast<int>(std::floor((sample_y + glyph_slot_height) / cell_height_float));
+    first_cell_y = std::max(0, first_cell_y);
+    last_cell_y = std::min(current_screen_height_chars_internal - 1, last_cell_y);
+
+    for (int glyph_cell_y = first_cell_y; glyph_cell_y <= last_cell_y; ++glyph_cell_y) {
+        const ScreenCell* cell_row = &next_buffer[static_cast<size_t>(glyph_cell_y) * current_screen_width_chars_internal];
+        for (int cell_x = 0; cell_x < current_screen_width_chars_internal; ++cell_x) {
+            const ScreenCell& cell = cell_row[cell_x];
+            const AtlasGlyph& glyph = glyph_table[static_cast<unsigned char>(cell.character)];
+            if (glyph.width == 0) continue;
+
+            float glyph_width = static_cast<float>(glyph.width);
+            float glyph_height = static_cast<float>(glyph.height);
+            float glyph_top = glyph_cell_y * cell_height_float + (cell_height_float - glyph_height) / 2.0f;
+            if (sample_y < glyph_top || sample_y >= glyph_top + glyph_height) continue;
+
+            // Nearest texel; the SFML path samples the same rect with bilinear filtering
+            int texel_y = std::min(glyph.height - 1, static_cast<int>(sample_y - glyph_top));
+            const std::uint8_t* coverage_row =
+                &glyph_atlas[static_cast<size_t>(glyph.atlas_y + texel_y) * glyph_atlas_width + glyph.atlas_x];
+
+            float glyph_left = cell_x * cell_width_float + pixel_shift_x + (cell_width_float - glyph_width) / 2.0f;
+            int span_begin = std::max(0, firstCoveredPixel(glyph_left));
+            int span_end = std::min(target_width_px_internal, firstCoveredPixel(glyph_left + glyph_width));
+            for (int pixel_x = span_begin; pixel_x < span_end; ++pixel_x) {
+                int texel_x = std::min(glyph.width - 1, static_cast<int>(static_cast<float>(pixel_x) + 0.5f - glyph_left));
+                unsigned int alpha = (static_cast<unsigned int>(coverage_row[texel_x]) * cell.fg_color.a + 127) / 255;
+                blendPixel(&row_pixels[pixel_x * 4], cell.fg_color, alpha);
+            }
+        }
+    }
+}
+
+bool SoftwareRenderer::saveToFile(const std::string& path) const {
+    if (!initialized || pixels.empty()) return false;
+    // sf::Image is a plain CPU pixel array, so this stays context-free
+    sf::Image image;
+    image.create(static_cast<unsigned int>(target_width_px_internal),
+                 static_cast<unsigned int>(target_height_px_internal), pixels.data());
+    if (!image.saveToFile(path)) {
+        std::cerr << "SoftwareRenderer::saveToFile() - ERROR: Could not write " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void SoftwareRenderer::shutdown() {
+    if (ft_face != nullptr) {
+        FT_Done_Face(ft_face);
+        ft_face = nullptr;
+    }
+    if (ft_library != nullptr) {
+        FT_Done_FreeType(ft_library);
+        ft_library = nullptr;
+    }
+    initialized = false;
+}
+
+} // namespace Core
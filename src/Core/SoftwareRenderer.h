@@ -0,0 +1,90 @@
+// File: EmergentKingdoms/src/Core/SoftwareRenderer.h
+#pragma once
+
+#include <vector>
+#include <array>
+#include <string>
+#include <cstdint>
+#include <SFML/Graphics.hpp>
+#include "BaseConfig.h"
+#include "ScreenCell.h"
+#include "IRenderBackend.h"
+
+struct FT_LibraryRec_;
+struct FT_FaceRec_;
+
+namespace Core {
+
+/**
+ * CPU backend for the ScreenCell grid: rasterises cells straight into an RGBA8
+ * pixel buffer without an OpenGL context (headless benchmarks, screenshots,
+ * serving frames to thin clients).
+ *
+ * Glyphs are rasterised once per font size with FreeType, using the same load
+ * flags as sf::Font, into an in-memory 8-bit coverage atlas. Compositing follows
+ * the SFML path: every background quad first, then the glyph quads in cell order
+ * with the glyph centred in its cell and alpha-blended over what lies below.
+ */
+class SoftwareRenderer : public IRenderBackend {
+public:
+    SoftwareRenderer();
+    ~SoftwareRenderer();
+
+    SoftwareRenderer(const SoftwareRenderer&) = delete;
+    SoftwareRenderer& operator=(const SoftwareRenderer&) = delete;
+
+    bool initialize(int target_width_px, int target_height_px, unsigned int initial_sfml_font_size);
+    void updateLayout(unsigned int new_sfml_font_size,
+                      int new_char_cell_width_px, int new_char_cell_height_px,
+                      int new_screen_width_chars, int new_screen_height_chars) override;
+    void prepareFrame() override;
+    void setCell(int x, int y, char character, const sf::Color& fg_color = Colors::WHITE, const sf::Color& bg_color = Colors::BLACK);
+    void setCell(int x, int y, const ScreenCell& cell) override;
+    void buildFrame() override {}                                  // Cells are read directly while rasterising
+    void present(float pixel_shift_x, float pixel_shift_y) override; // Rasterise into getPixels()
+    void shutdown() override;
+    bool isInitialized() const override { return initialized; }
+
+    // Last rendered frame, row-major RGBA8
+    const std::vector<std::uint8_t>& getPixels() const { return pixels; }
+    int getWidthPx() const { return target_width_px_internal; }
+    int getHeightPx() const { return target_height_px_internal; }
+    bool saveToFile(const std::string& path) const;
+
+private:
+    // One glyph's rectangle in the coverage atlas
+    struct AtlasGlyph {
+        int atlas_x = 0;
+        int atlas_y = 0;
+        int width = 0;
+        int height = 0;
+    };
+
+    FT_LibraryRec_* ft_library;
+    FT_FaceRec_* ft_face;
+
+    // 16x16 grid of fixed-size slots, one per 8-bit character
+    std::vector<std::uint8_t> glyph_atlas;
+    int glyph_atlas_width;
+    int glyph_slot_width;
+    int glyph_slot_height;
+    std::array<AtlasGlyph, 256> glyph_table; // Indexed by the cell character as unsigned char
+
+    std::vector<ScreenCell> next_buffer;
+    std::vector<std::uint8_t> pixels;
+
+    int target_width_px_internal;
+    int target_height_px_internal;
+    unsigned int current_sfml_font_size_internal;
+    int current_char_cell_width_px_internal;
+    int current_char_cell_height_px_internal;
+    int current_screen_width_chars_internal;
+    int current_screen_height_chars_internal;
+
+    bool initialized = false;
+
+    void rebuildGlyphAtlas();
+    void rasterizeRow(int pixel_y, float pixel_shift_x, float pixel_shift_y);
+};
+
+} // namespace Core
@@ -0,0 +1,56 @@
+// File: EmergentKingdoms/src/Core/TripleBuffer.h
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace Core {
+
+/**
+ * Lock-free single-producer / single-consumer triple buffer.
+ * The writer fills writeBuffer() and publish()es it; the reader calls
+ * acquireLatest() and then reads readBuffer() undisturbed until its next
+ * acquire. Neither side ever blocks; intermediate publishes the reader did not
+ * pick up are simply replaced by newer ones.
+ */
+template <typename T>
+class TripleBuffer {
+public:
+    TripleBuffer() : write_index(0), shared_state(1), read_index(2) {}
+
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    // ===== WRITER SIDE =====
+    T& writeBuffer() { return buffers[write_index]; }
+
+    // Hand the written buffer to the reader and take back the spare one
+    void publish() {
+        std::uint8_t previous = shared_state.exchange(static_cast<std::uint8_t>(write_index | FRESH_BIT),
+                                                      std::memory_order_acq_rel);
+        write_index = previous & INDEX_MASK;
+    }
+
+    // ===== READER SIDE =====
+    // Swap in the newest published buffer; false if nothing new was published
+    bool acquireLatest() {
+        if ((shared_state.load(std::memory_order_relaxed) & FRESH_BIT) == 0) return false;
+        std::uint8_t previous = shared_state.exchange(read_index, std::memory_order_acq_rel);
+        read_index = previous & INDEX_MASK;
+        return true;
+    }
+
+    const T& readBuffer() const { return buffers[read_index]; }
+
+private:
+    static constexpr std::uint8_t INDEX_MASK = 0x3;
+    static constexpr std::uint8_t FRESH_BIT = 0x4;
+
+    std::array<T, 3> buffers;
+    std::uint8_t write_index;                // Owned by the writer
+    std::atomic<std::uint8_t> shared_state;  // Spare buffer index, FRESH_BIT when it holds a new publish
+    std::uint8_t read_index;                 // Owned by the reader
+};
+
+} // namespace Core
@@ -0,0 +1,29 @@
+// File: EmergentKingdoms/src/Core/WorldSnapshot.h
+#pragma once
+
+#include <vector>
+#include "Renderer.h"
+
+namespace Core {
+
+// One entity as the render thread sees it; prev_* is its position one tick earlier
+struct EntitySnapshot {
+    int prev_x = 0;
+    int prev_y = 0;
+    int x = 0;
+    int y = 0;
+    ScreenCell display_cell;
+};
+
+/**
+ * Immutable state published by the simulation thread after every tick.
+ * The simulation does not edit tiles; the map stays owned by the render thread.
+ */
+struct WorldSnapshot {
+    unsigned long long tick = 0;
+    float wave_flow_offset = 0.0f; // Water animation progress used by the renderers
+    float animation_time = 0.0f;   // Seconds of animation time; vegetation objects are evaluated from it
+    std::vector<EntitySnapshot> entities;
+};
+
+} // namespace Core
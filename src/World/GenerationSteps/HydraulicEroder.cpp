@@ -17,19 +17,31 @@ HydraulicEroder::HydraulicEroder() {
     Ks = Core::Ks;
     Ke = Core::Ke;
     Kd = Core::Kd;
+    use_temporal_tiling = Core::EROSION_USE_TEMPORAL_TILING;
+    tile_size = std::max(1, Core::EROSION_TILE_SIZE);
+    temporal_depth = std::max(1, Core::EROSION_TEMPORAL_DEPTH);
 }
 
 void HydraulicEroder::process(WorldData& world_data, unsigned int base_world_seed, int step_seed_offset) {
     (void)base_world_seed; // Not used
     (void)step_seed_offset; // Not used
 
-    const size_t current_map_size = static_cast<size_t>(world_data.map_width) * static_cast<size_t>(world_data.map_height);
     if (iterations == 0) {
         std::cout << "  Skipping iterative hydraulic erosion (0 iterations)." << std::endl;
         return;
     }
     std::cout << "  Applying iterative hydraulic erosion..." << std::endl;
-    
+
+    if (use_temporal_tiling) {
+        processTemporalTiles(world_data);
+    } else {
+        processFullSweep(world_data);
+    }
+    std::cout << "  Finished iterative hydraulic erosion." << std::endl;
+}
+
+void HydraulicEroder::processFullSweep(WorldData& world_data) {
+    const size_t current_map_size = static_cast<size_t>(world_data.map_width) * static_cast<size_t>(world_data.map_height);
     std::vector<float> water_map(current_map_size, 0.0f);
     std::vector<float> sediment_map(current_map_size, 0.0f);
     std::vector<std::vector<float>> outflow_flux(current_map_size, std::vector<float>(4, 0.0f));
@@ -173,7 +185,198 @@ void HydraulicEroder::process(WorldData& world_data, unsigned int base_world_see
             sediment_map[i] = std::max(0.0f, sediment_map[i] * (1.0f - Ke*0.1f)); 
         }
     }
-    std::cout << "  Finished iterative hydraulic erosion." << std::endl;
+}
+
+void HydraulicEroder::processTemporalTiles(WorldData& world_data) {
+    const size_t current_map_size = static_cast<size_t>(world_data.map_width) * static_cast<size_t>(world_data.map_height);
+    const int tiles_x = (world_data.map_width + tile_size - 1) / tile_size;
+    const int tiles_y = (world_data.map_height + tile_size - 1) / tile_size;
+    const int tile_count = tiles_x * tiles_y;
+
+    std::vector<float> water_map(current_map_size, 0.0f);
+    std::vector<float> sediment_map(current_map_size, 0.0f);
+    std::vector<float> next_heightmap(current_map_size);
+    std::vector<float> next_water_map(current_map_size);
+    std::vector<float> next_sediment_map(current_map_size);
+
+    int iterations_done = 0;
+    while (iterations_done < iterations) {
+        int depth = std::min(temporal_depth, iterations - iterations_done);
+        std::cout << "    Hydraulic erosion iterations " << iterations_done + 1 << "-" << iterations_done + depth
+                  << "/" << iterations << " (" << tile_count << " tiles)..." << std::endl;
+
+        #pragma omp parallel
+        {
+            TileScratch scratch;
+
+            #pragma omp for schedule(dynamic)
+            for (int t = 0; t < tile_count; ++t) {
+                erodeTile(world_data, t % tiles_x, t / tiles_x, depth,
+                          water_map, sediment_map,
+                          next_heightmap, next_water_map, next_sediment_map, scratch);
+            }
+        }
+
+        world_data.heightmap_data.swap(next_heightmap);
+        water_map.swap(next_water_map);
+        sediment_map.swap(next_sediment_map);
+        iterations_done += depth;
+    }
+}
+
+void HydraulicEroder::erodeTile(const WorldData& world_data, int tile_x, int tile_y, int depth,
+                                const std::vector<float>& water_map, const std::vector<float>& sediment_map,
+                                std::vector<float>& next_heightmap, std::vector<float>& next_water_map,
+                                std::vector<float>& next_sediment_map, TileScratch& scratch) const {
+    // Rows clipped at the map edge are real boundaries and behave exactly like the full sweep.
+    // Neighbours missing at the halo edge produce stale values that move inwards by at most
+    // two cells per iteration, so they never reach the interior.
+    const int halo = 2 * depth;
+    const int interior_x0 = tile_x * tile_size;
+    const int interior_y0 = tile_y * tile_size;
+    const int interior_w = std::min(tile_size, world_data.map_width - interior_x0);
+    const int interior_h = std::min(tile_size, world_data.map_height - interior_y0);
+
+    const int local_x0 = interior_x0 - halo; // Wrapped on load
+    const int local_y0 = std::max(0, interior_y0 - halo);
+    const int local_y1 = std::min(world_data.map_height, interior_y0 + interior_h + halo);
+    const int local_w = interior_w + 2 * halo;
+    const int local_h = local_y1 - local_y0;
+    const size_t local_size = static_cast<size_t>(local_w) * local_h;
+
+    std::vector<float>& h = scratch.height;
+    std::vector<float>& w = scratch.water;
+    std::vector<float>& s = scratch.sediment;
+    std::vector<float>& nw = scratch.next_water;
+    std::vector<float>& ns = scratch.next_sediment;
+    std::vector<float>& flux = scratch.flux;
+    std::vector<float>& slope = scratch.slope;
+    std::vector<unsigned char>& lake = scratch.lake;
+    h.resize(local_size);
+    w.resize(local_size);
+    s.resize(local_size);
+    nw.resize(local_size);
+    ns.resize(local_size);
+    flux.resize(local_size * 4);
+    slope.resize(local_size);
+    lake.resize(local_size);
+
+    for (int ly = 0; ly < local_h; ++ly) {
+        size_t map_row = static_cast<size_t>(local_y0 + ly) * world_data.map_width;
+        for (int lx = 0; lx < local_w; ++lx) {
+            int map_x = ((local_x0 + lx) % world_data.map_width + world_data.map_width) % world_data.map_width;
+            size_t map_idx = map_row + map_x;
+            size_t local_idx = static_cast<size_t>(ly) * local_w + lx;
+            h[local_idx] = world_data.heightmap_data[map_idx];
+            w[local_idx] = water_map[map_idx];
+            s[local_idx] = sediment_map[map_idx];
+            slope[local_idx] = world_data.slope_map[map_idx];
+            lake[local_idx] = world_data.is_lake_tile[map_idx] ? 1 : 0;
+        }
+    }
+
+    const int dx4[] = {0, 1, 0, -1};
+    const int dy4[] = {-1, 0, 1, 0};
+    const int inflow_directions[] = {2, 3, 0, 1};
+
+    for (int d = 0; d < depth; ++d) {
+        // 1. Rain
+        for (size_t i = 0; i < local_size; ++i) {
+            w[i] += lake[i] ? 0.001f : 0.01f;
+        }
+
+        // 2. Outflow flux
+        for (int ly = 0; ly < local_h; ++ly) {
+            for (int lx = 0; lx < local_w; ++lx) {
+                size_t current_idx = static_cast<size_t>(ly) * local_w + lx;
+                float h_total_current = h[current_idx] + w[current_idx];
+                float total_dH_positive = 0.0f;
+                float dH[4];
+
+                for (int i = 0; i < 4; ++i) {
+                    int ny = ly + dy4[i];
+                    int nx = lx + dx4[i];
+                    if (ny >= 0 && ny < local_h && nx >= 0 && nx < local_w) {
+                        size_t neighbor_idx = static_cast<size_t>(ny) * local_w + nx;
+                        dH[i] = h_total_current - (h[neighbor_idx] + w[neighbor_idx]);
+                    } else {
+                        dH[i] = h_total_current;
+                    }
+                    if (dH[i] > 0) total_dH_positive += dH[i];
+                }
+
+                for (int i = 0; i < 4; ++i) {
+                    float f = 0.0f;
+                    if (dH[i] > 0 && total_dH_positive > 1e-6f) {
+                        f = std::min(w[current_idx], dH[i]) * (dH[i] / total_dH_positive);
+                    }
+                    flux[current_idx * 4 + i] = std::max(0.0f, f);
+                }
+            }
+        }
+
+        // 3. Water and sediment transport
+        for (int ly = 0; ly < local_h; ++ly) {
+            for (int lx = 0; lx < local_w; ++lx) {
+                size_t current_idx = static_cast<size_t>(ly) * local_w + lx;
+                float water_out = 0.0f;
+                for (int dir = 0; dir < 4; ++dir) water_out += flux[current_idx * 4 + dir];
+
+                float water_in = 0.0f;
+                float sed_in = 0.0f;
+                for (int i = 0; i < 4; ++i) {
+                    int ny = ly + dy4[i];
+                    int nx = lx + dx4[i];
+                    if (ny < 0 || ny >= local_h || nx < 0 || nx >= local_w) continue;
+                    size_t neighbor_idx = static_cast<size_t>(ny) * local_w + nx;
+                    float neighbor_flux = flux[neighbor_idx * 4 + inflow_directions[i]];
+                    water_in += neighbor_flux;
+                    float neighbor_water_safe = std::max(1e-6f, w[neighbor_idx]);
+                    sed_in += s[neighbor_idx] * (neighbor_flux / neighbor_water_safe);
+                }
+
+                nw[current_idx] = w[current_idx] - water_out + water_in;
+
+                float current_water_safe = std::max(1e-6f, w[current_idx]);
+                float sed_out = s[current_idx] * (water_out / current_water_safe);
+                ns[current_idx] = std::max(0.0f, s[current_idx] - sed_out + sed_in);
+            }
+        }
+        w.swap(nw);
+        s.swap(ns);
+
+        // 4-5. Erosion/deposition, height clamp and evaporation, fused per cell
+        for (size_t i = 0; i < local_size; ++i) {
+            float height_change = 0.0f;
+            if (!lake[i]) {
+                float C = std::max(0.0f, Ks * slope[i] * w[i]);
+                if (s[i] < C) {
+                    float erode_amount = Kr * slope[i] * w[i];
+                    erode_amount = std::min(erode_amount, C - s[i]);
+                    erode_amount = std::min(erode_amount, h[i] * 0.01f);
+                    height_change -= erode_amount;
+                    s[i] += erode_amount;
+                } else {
+                    float deposit_amount = Kd * (s[i] - C);
+                    deposit_amount = std::min(deposit_amount, s[i]);
+                    height_change += deposit_amount;
+                    s[i] -= deposit_amount;
+                }
+            }
+            h[i] = Utils::clamp_val(h[i] + height_change, 0.0f, 1.0f);
+            w[i] *= (1.0f - Ke);
+            s[i] = std::max(0.0f, s[i] * (1.0f - Ke*0.1f));
+        }
+    }
+
+    // Write back the interior only
+    for (int y = interior_y0; y < interior_y0 + interior_h; ++y) {
+        size_t local_row = static_cast<size_t>(y - local_y0) * local_w + halo;
+        size_t map_row = static_cast<size_t>(y) * world_data.map_width + interior_x0;
+        std::copy(h.begin() + local_row, h.begin() + local_row + interior_w, next_heightmap.begin() + map_row);
+        std::copy(w.begin() + local_row, w.begin() + local_row + interior_w, next_water_map.begin() + map_row);
+        std::copy(s.begin() + local_row, s.begin() + local_row + interior_w, next_sediment_map.begin() + map_row);
+    }
 }
 
 } // namespace Generation
@@ -1,6 +1,7 @@
 // File: EmergentKingdoms/src/World/GenerationSteps/HydraulicEroder.h
 #pragma once
 #include "IGenerationStep.h"
+#include <vector>
 
 namespace World {
 namespace Generation {
@@ -14,6 +15,34 @@ public:
 private:
     int iterations;
     float Kr, Ks, Ke, Kd; // Erosion constants
+
+    // Temporal tiling settings
+    bool use_temporal_tiling;
+    int tile_size;
+    int temporal_depth;
+
+    // Per-thread scratch for one tile plus its halo
+    struct TileScratch {
+        std::vector<float> height;
+        std::vector<float> water;
+        std::vector<float> sediment;
+        std::vector<float> next_water;
+        std::vector<float> next_sediment;
+        std::vector<float> flux; // 4 entries per cell (N, E, S, W)
+        std::vector<float> slope;
+        std::vector<unsigned char> lake;
+    };
+
+    // Reference path: one full-map sweep per stage per iteration
+    void processFullSweep(WorldData& world_data);
+
+    // Tiled path: flux and transport read two cells out per iteration, so each tile carries
+    // a halo of two cells per fused iteration and writes back only its interior
+    void processTemporalTiles(WorldData& world_data);
+    void erodeTile(const WorldData& world_data, int tile_x, int tile_y, int depth,
+                   const std::vector<float>& water_map, const std::vector<float>& sediment_map,
+                   std::vector<float>& next_heightmap, std::vector<float>& next_water_map,
+                   std::vector<float>& next_sediment_map, TileScratch& scratch) const;
 };
 
 } // namespace Generation
@@ -15,6 +15,9 @@ ThermalEroder::ThermalEroder() {
     iterations = Core::THERMAL_EROSION_ITERATIONS;
     talus_angle_factor = Core::THERMAL_EROSION_TALUS_ANGLE_FACTOR;
     strength = Core::THERMAL_EROSION_STRENGTH;
+    use_temporal_tiling = Core::EROSION_USE_TEMPORAL_TILING;
+    tile_size = std::max(1, Core::EROSION_TILE_SIZE);
+    temporal_depth = std::max(1, Core::EROSION_TEMPORAL_DEPTH);
 }
 
 void ThermalEroder::process(WorldData& world_data, unsigned int base_world_seed, int step_seed_offset) {
@@ -27,6 +30,14 @@ void ThermalEroder::process(WorldData& world_data, unsigned int base_world_seed,
     }
     std::cout << "  Applying thermal erosion..." << std::endl;
 
+    if (use_temporal_tiling) {
+        processTemporalTiles(world_data);
+    } else {
+        processFullSweep(world_data);
+    }
+}
+
+void ThermalEroder::processFullSweep(WorldData& world_data) {
     const size_t current_map_size = static_cast<size_t>(world_data.map_width) * static_cast<size_t>(world_data.map_height);
     std::vector<float> temp_heightmap_read; 
     std::vector<float> temp_heightmap_write(current_map_size); 
@@ -114,5 +125,143 @@ void ThermalEroder::process(WorldData& world_data, unsigned int base_world_seed,
     }
 }
 
+void ThermalEroder::processTemporalTiles(WorldData& world_data) {
+    const size_t current_map_size = static_cast<size_t>(world_data.map_width) * static_cast<size_t>(world_data.map_height);
+    const int tiles_x = (world_data.map_width + tile_size - 1) / tile_size;
+    const int tiles_y = (world_data.map_height + tile_size - 1) / tile_size;
+    const int tile_count = tiles_x * tiles_y;
+    std::vector<float> next_heightmap(current_map_size);
+
+    int iterations_done = 0;
+    while (iterations_done < iterations) {
+        int depth = std::min(temporal_depth, iterations - iterations_done);
+
+        #pragma omp parallel
+        {
+            // Per-thread tile buffers, reused across tiles
+            std::vector<float> local_a;
+            std::vector<float> local_b;
+            std::vector<unsigned char> local_fixed;
+
+            #pragma omp for schedule(dynamic)
+            for (int t = 0; t < tile_count; ++t) {
+                erodeTile(world_data, t % tiles_x, t / tiles_x, depth,
+                          next_heightmap, local_a, local_b, local_fixed);
+            }
+        }
+
+        world_data.heightmap_data.swap(next_heightmap);
+        iterations_done += depth;
+        std::cout << "  Thermal erosion iterations " << iterations_done << "/" << iterations
+                  << " done (" << tile_count << " tiles, " << depth << " fused)." << std::endl;
+    }
+}
+
+void ThermalEroder::erodeTile(const WorldData& world_data, int tile_x, int tile_y, int depth,
+                              std::vector<float>& next_heightmap,
+                              std::vector<float>& local_a, std::vector<float>& local_b,
+                              std::vector<unsigned char>& local_fixed) const {
+    // Each iteration is a 3x3 stencil, so `depth` iterations need a halo of `depth` cells.
+    // Halo cells are computed with truncated neighbourhoods and go stale from the outside in,
+    // but never reach the interior. Rows clipped at the map edge are real boundaries and
+    // skip out-of-range neighbours exactly like the full sweep.
+    const int halo = depth;
+    const int interior_x0 = tile_x * tile_size;
+    const int interior_y0 = tile_y * tile_size;
+    const int interior_w = std::min(tile_size, world_data.map_width - interior_x0);
+    const int interior_h = std::min(tile_size, world_data.map_height - interior_y0);
+
+    const int local_x0 = interior_x0 - halo; // Wrapped on load
+    const int local_y0 = std::max(0, interior_y0 - halo);
+    const int local_y1 = std::min(world_data.map_height, interior_y0 + interior_h + halo);
+    const int local_w = interior_w + 2 * halo;
+    const int local_h = local_y1 - local_y0;
+    const size_t local_size = static_cast<size_t>(local_w) * local_h;
+
+    local_a.resize(local_size);
+    local_b.resize(local_size);
+    local_fixed.resize(local_size);
+
+    for (int ly = 0; ly < local_h; ++ly) {
+        size_t map_row = static_cast<size_t>(local_y0 + ly) * world_data.map_width;
+        for (int lx = 0; lx < local_w; ++lx) {
+            int map_x = ((local_x0 + lx) % world_data.map_width + world_data.map_width) % world_data.map_width;
+            size_t map_idx = map_row + map_x;
+            size_t local_idx = static_cast<size_t>(ly) * local_w + lx;
+            local_a[local_idx] = world_data.heightmap_data[map_idx];
+            local_fixed[local_idx] = (world_data.is_lake_tile[map_idx] || world_data.is_river_tile[map_idx]) ? 1 : 0;
+        }
+    }
+
+    std::vector<float>* read = &local_a;
+    std::vector<float>* write = &local_b;
+
+    for (int d = 0; d < depth; ++d) {
+        const std::vector<float>& src = *read;
+        std::vector<float>& dst = *write;
+
+        for (int ly = 0; ly < local_h; ++ly) {
+            for (int lx = 0; lx < local_w; ++lx) {
+                size_t current_idx = static_cast<size_t>(ly) * local_w + lx;
+                float current_h = src[current_idx];
+
+                if (local_fixed[current_idx]) {
+                    dst[current_idx] = Utils::clamp_val(current_h, 0.0f, 1.0f);
+                    continue;
+                }
+
+                // Same accumulation order as the full sweep's outflow and inflow passes
+                float new_h_current = current_h;
+                float material_added = 0.0f;
+                for (int dy_offset = -1; dy_offset <= 1; ++dy_offset) {
+                    int ny = ly + dy_offset;
+                    if (ny < 0 || ny >= local_h) continue;
+                    for (int dx_offset = -1; dx_offset <= 1; ++dx_offset) {
+                        if (dx_offset == 0 && dy_offset == 0) continue;
+                        int nx = lx + dx_offset;
+                        if (nx < 0 || nx >= local_w) continue;
+
+                        float height_diff = current_h - src[static_cast<size_t>(ny) * local_w + nx];
+                        if (height_diff > talus_angle_factor) {
+                            float material_to_move = (height_diff - talus_angle_factor) * strength;
+                            material_to_move = std::min(material_to_move, height_diff / 2.1f);
+                            material_to_move = std::max(0.0f, material_to_move);
+                            new_h_current -= material_to_move;
+                        }
+                    }
+                }
+                for (int dy_offset = -1; dy_offset <= 1; ++dy_offset) {
+                    int ny = ly + dy_offset;
+                    if (ny < 0 || ny >= local_h) continue;
+                    for (int dx_offset = -1; dx_offset <= 1; ++dx_offset) {
+                        if (dx_offset == 0 && dy_offset == 0) continue;
+                        int nx = lx + dx_offset;
+                        if (nx < 0 || nx >= local_w) continue;
+
+                        float height_diff_from_neighbor = src[static_cast<size_t>(ny) * local_w + nx] - current_h;
+                        if (height_diff_from_neighbor > talus_angle_factor) {
+                            float material_received = (height_diff_from_neighbor - talus_angle_factor) * strength;
+                            material_received = std::min(material_received, height_diff_from_neighbor / 2.1f);
+                            material_received = std::max(0.0f, material_received);
+                            material_added += material_received;
+                        }
+                    }
+                }
+                dst[current_idx] = Utils::clamp_val(new_h_current + material_added, 0.0f, 1.0f);
+            }
+        }
+        std::swap(read, write);
+    }
+
+    // Write back the interior only
+    const std::vector<float>& result = *read;
+    for (int y = interior_y0; y < interior_y0 + interior_h; ++y) {
+        size_t local_row = static_cast<size_t>(y - local_y0) * local_w + halo;
+        size_t map_row = static_cast<size_t>(y) * world_data.map_width + interior_x0;
+        std::copy(result.begin() + local_row, result.begin() + local_row + interior_w,
+                  next_heightmap.begin() + map_row);
+    }
+}
+
 } // namespace Generation
 } // namespace World
\ No newline at end of file
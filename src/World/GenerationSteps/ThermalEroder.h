@@ -1,6 +1,7 @@
 // File: EmergentKingdoms/src/World/GenerationSteps/ThermalEroder.h
 #pragma once
 #include "IGenerationStep.h"
+#include <vector>
 
 namespace World {
 namespace Generation {
@@ -15,7 +16,23 @@ private:
     int iterations;
     float talus_angle_factor;
     float strength;
+
+    // Temporal tiling settings
+    bool use_temporal_tiling;
+    int tile_size;
+    int temporal_depth;
+
+    // Reference path: one full-map sweep per iteration
+    void processFullSweep(WorldData& world_data);
+
+    // Tiled path: each tile (plus a halo of one cell per fused iteration) is eroded
+    // for several iterations in a local buffer, then only its interior is written back
+    void processTemporalTiles(WorldData& world_data);
+    void erodeTile(const WorldData& world_data, int tile_x, int tile_y, int depth,
+                   std::vector<float>& next_heightmap,
+                   std::vector<float>& local_a, std::vector<float>& local_b,
+                   std::vector<unsigned char>& local_fixed) const;
 };
 
 } // namespace Generation
-} // namespace World
\ No newline at end of file
+} // namespace World
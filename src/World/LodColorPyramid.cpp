@@ -0,0 +1,88 @@
+// File: EmergentKingdoms/src/World/LodColorPyramid.cpp
+#include "LodColorPyramid.h"
+#include <algorithm>
+#include <iostream>
+#include <omp.h>
+
+namespace World {
+
+void LodColorPyramid::build(const std::vector<Tile>& tiles, int width, int height, int level_count) {
+    map_width = width;
+    map_height = height;
+    levels.clear();
+
+    int level_width = width;
+    int level_height = height;
+    for (int level_index = 0; level_index < level_count && (level_width > 1 || level_height > 1); ++level_index) {
+        level_width = (level_width + 1) / 2;
+        level_height = (level_height + 1) / 2;
+
+        Level level;
+        level.width = level_width;
+        level.height = level_height;
+        level.colors.resize(static_cast<size_t>(level_width) * level_height);
+        levels.push_back(std::move(level));
+
+        // Each level reads only the one below it, so rows within a level are independent
+        #pragma omp parallel for schedule(static)
+        for (int texel_y = 0; texel_y < level_height; ++texel_y) {
+            for (int texel_x = 0; texel_x < level_width; ++texel_x) {
+                levels[level_index].colors[static_cast<size_t>(texel_y) * level_width + texel_x] =
+                    averageTexel(tiles, level_index, texel_x, texel_y);
+            }
+        }
+    }
+    std::cout << "  LOD colour pyramid: " << levels.size() << " levels, coarsest "
+              << level_width << "x" << level_height << std::endl;
+}
+
+void LodColorPyramid::updateTile(const std::vector<Tile>& tiles, int x, int y) {
+    int texel_x = x;
+    int texel_y = y;
+    for (int level_index = 0; level_index < static_cast<int>(levels.size()); ++level_index) {
+        texel_x /= 2;
+        texel_y /= 2;
+        Level& level = levels[level_index];
+        level.colors[static_cast<size_t>(texel_y) * level.width + texel_x] =
+            averageTexel(tiles, level_index, texel_x, texel_y);
+    }
+}
+
+const sf::Color& LodColorPyramid::sample(int level, int x, int y) const {
+    level = std::min(std::max(level, 1), getLevelCount());
+    const Level& lod_level = levels[level - 1];
+    x = ((x % map_width) + map_width) % map_width;
+    y = std::min(std::max(y, 0), map_height - 1);
+    int texel_x = std::min(x >> level, lod_level.width - 1);
+    int texel_y = std::min(y >> level, lod_level.height - 1);
+    return lod_level.colors[static_cast<size_t>(texel_y) * lod_level.width + texel_x];
+}
+
+sf::Color LodColorPyramid::averageTexel(const std::vector<Tile>& tiles, int level_index, int texel_x, int texel_y) const {
+    // Children are tiles for level 1, otherwise texels of the level below
+    int child_width = (level_index == 0) ? map_width : levels[level_index - 1].width;
+    int child_height = (level_index == 0) ? map_height : levels[level_index - 1].height;
+
+    unsigned int sum_r = 0, sum_g = 0, sum_b = 0, count = 0;
+    for (int dy = 0; dy < 2; ++dy) {
+        int child_y = texel_y * 2 + dy;
+        if (child_y >= child_height) continue;
+        for (int dx = 0; dx < 2; ++dx) {
+            int child_x = texel_x * 2 + dx;
+            if (child_x >= child_width) continue;
+            size_t child_index = static_cast<size_t>(child_y) * child_width + child_x;
+            const sf::Color& child = (level_index == 0) ? tiles[child_index].display_cell.bg_color
+                                                        : levels[level_index - 1].colors[child_index];
+            sum_r += child.r;
+            sum_g += child.g;
+            sum_b += child.b;
+            ++count;
+        }
+    }
+    if (count == 0) return sf::Color::Black;
+    return sf::Color(static_cast<sf::Uint8>((sum_r + count / 2) / count),
+                     static_cast<sf::Uint8>((sum_g + count / 2) / count),
+                     static_cast<sf::Uint8>((sum_b + count / 2) / count));
+}
+
+} // namespace World
@@ -0,0 +1,43 @@
+// File: EmergentKingdoms/src/World/LodColorPyramid.h
+#pragma once
+#include "Tile.h"
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+namespace World {
+
+/**
+ * Mip pyramid of averaged tile background colours for zoomed-out rendering.
+ * Level k (1..getLevelCount()) holds one texel per 2^k x 2^k block of tiles,
+ * so a LOD cell of 2^k tiles reads exactly one precomputed colour instead of
+ * point-sampling a single tile. Edge texels average only the tiles that exist.
+ */
+class LodColorPyramid {
+public:
+    // Build levels 1..level_count from the tiles' finalised display backgrounds
+    void build(const std::vector<Tile>& tiles, int map_width, int map_height, int level_count);
+
+    // Re-average the texels above one changed tile, level by level
+    void updateTile(const std::vector<Tile>& tiles, int x, int y);
+
+    int getLevelCount() const { return static_cast<int>(levels.size()); }
+    bool isBuilt() const { return !levels.empty(); }
+
+    // Colour of the level-k texel containing tile (x, y); x wraps, y is clamped
+    const sf::Color& sample(int level, int x, int y) const;
+
+private:
+    struct Level {
+        int width = 0;
+        int height = 0;
+        std::vector<sf::Color> colors;
+    };
+
+    int map_width = 0;
+    int map_height = 0;
+    std::vector<Level> levels; // levels[0] is level 1 (2x2 tiles per texel)
+
+    sf::Color averageTexel(const std::vector<Tile>& tiles, int level_index, int texel_x, int texel_y) const;
+};
+
+} // namespace World
@@ -14,11 +14,17 @@
 #include <iostream>
 #include <stdexcept>
 #include <cassert>
+#include <algorithm>
+#include <omp.h>
 
 namespace World {
 
 Map::Map(int width, int height, unsigned int seed)
-    : width(width), height(height), seed(seed), vegetation_object_manager(nullptr) {
+    : width(width), height(height), seed(seed),
+      vegetation_object_manager(nullptr) {
+    for (DirtyTileBox& box : dirty_boxes) {
+        clearDirtyTileBox(box);
+    }
     
     if (width <= 0 || height <= 0) {
         throw std::invalid_argument("Map dimensions must be positive");
@@ -107,6 +113,19 @@ void Map::runGenerationPipeline() {
             throw;
         }
     }
+    
+    finalizeTileDisplays();
+}
+
+void Map::finalizeTileDisplays() {
+    // Single batched render evaluation per tile, after all steps have settled tile types
+    std::cout << "Finalizing tile displays..." << std::endl;
+    
+    #pragma omp parallel for
+    for (size_t i = 0; i < tiles.size(); ++i) {
+        tiles[i].updateDisplay();
+    }
+    lod_color_pyramid.build(tiles, width, height, Core::LOD_PYRAMID_LEVELS);
 }
 
 const Tile& Map::getTile(int x, int y) const {
@@ -127,6 +146,34 @@ void Map::setTile(int x, int y, const Tile& tile) {
     
     size_t index = getIndex(x, y);
     tiles[index] = tile;
+    tiles[index].updateDisplay();
+    if (lod_color_pyramid.isBuilt()) {
+        lod_color_pyramid.updateTile(tiles, x, y);
+    }
+    for (DirtyTileBox& box : dirty_boxes) {
+        box.min_x = std::min(box.min_x, x);
+        box.min_y = std::min(box.min_y, y);
+        box.max_x = std::max(box.max_x, x);
+        box.max_y = std::max(box.max_y, y);
+    }
+}
+
+bool Map::takeDirtyTileRegion(DirtyTileConsumer consumer, int& x, int& y, int& region_width, int& region_height) {
+    DirtyTileBox& box = dirty_boxes[static_cast<int>(consumer)];
+    if (box.max_x < box.min_x || box.max_y < box.min_y) return false;
+    x = box.min_x;
+    y = box.min_y;
+    region_width = box.max_x - box.min_x + 1;
+    region_height = box.max_y - box.min_y + 1;
+    clearDirtyTileBox(box);
+    return true;
+}
+
+void Map::clearDirtyTileBox(DirtyTileBox& box) const {
+    box.min_x = width;
+    box.min_y = height;
+    box.max_x = -1;
+    box.max_y = -1;
 }
 
 // ===== VEGETATION OBJECT SYSTEM INTEGRATION =====
@@ -152,7 +199,8 @@ bool Map::hasVegetationObjectAt(int x, int y) const {
     return vegetation_object_manager->hasTileAt(x, y);
 }
 
-Core::ScreenCell Map::getVegetationObjectDisplay(int x, int y, int entity_x, int entity_y) const {
+Core::ScreenCell Map::getVegetationObjectDisplay(int x, int y, int entity_x, int entity_y,
+                                                 float animation_time, float wind_strength) const {
     if (!vegetation_object_manager) {
         return {' ', sf::Color::Black, sf::Color::Black};
     }
@@ -165,7 +213,7 @@ Core::ScreenCell Map::getVegetationObjectDisplay(int x, int y, int entity_x, int
         return {' ', sf::Color::Black, sf::Color::Black};
     }
     
-    return vegetation_object_manager->getTileDisplay(x, y, entity_x, entity_y);
+    return vegetation_object_manager->getTileDisplay(x, y, entity_x, entity_y, animation_time, wind_strength);
 }
 
 bool Map::isVegetationPassable(int x, int y) const {
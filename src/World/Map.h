@@ -2,6 +2,7 @@
 #pragma once
 #include "Tile.h"
 #include "WorldData.h"
+#include "LodColorPyramid.h"
 #include "GenerationSteps/IGenerationStep.h"
 #include "../Core/Renderer.h"
 #include <vector>
@@ -20,6 +21,14 @@ namespace MultiTileObjects {
 
 namespace World {
 
+// Readers of the setTile dirty region; each gets its own bounding box, so one
+// consumer taking the region does not hide the edit from the other
+enum class DirtyTileConsumer {
+    MINIMAP,      // Background minimap rebuild
+    RENDER_CACHE, // Game's scroll-reuse cell cache
+    COUNT
+};
+
 /**
  * Main world map containing all terrain tiles and coordinating world generation
  * Supports cylindrical wrapping on X-axis and integrates multi-tile vegetation objects
@@ -41,10 +50,24 @@ public:
     unsigned int getSeed() const { return seed; }
     
     // ===== VEGETATION OBJECT SYSTEM INTEGRATION =====
+    // Point queries for single tiles (x wraps, y outside the map has no object): tools and
+    // the headless screenshot. The game view stamps whole objects instead, see
+    // VegetationObjectManager::collectObjectsInRect
     bool hasVegetationObjectAt(int x, int y) const;
-    Core::ScreenCell getVegetationObjectDisplay(int x, int y, int entity_x = -1, int entity_y = -1) const;
+    Core::ScreenCell getVegetationObjectDisplay(int x, int y, int entity_x = -1, int entity_y = -1,
+                                                float animation_time = 0.0f, float wind_strength = 1.0f) const;
     bool isVegetationPassable(int x, int y) const;
     void setVegetationObjectManager(Systems::Vegetation::MultiTileObjects::VegetationObjectManager* manager);
+    // For viewport queries by the renderer; nullptr before generation
+    const Systems::Vegetation::MultiTileObjects::VegetationObjectManager* getVegetationObjectManager() const {
+        return vegetation_object_manager;
+    }
+    
+    // Averaged background colours for zoomed-out rendering
+    const LodColorPyramid& getLodColorPyramid() const { return lod_color_pyramid; }
+    
+    // Bounding box of tiles changed by setTile since this consumer's last call; false if none changed
+    bool takeDirtyTileRegion(DirtyTileConsumer consumer, int& x, int& y, int& region_width, int& region_height);
     
     // World generation data access (for generation steps)
     std::vector<Tile>& getTilesRef() { return tiles; }
@@ -56,6 +79,14 @@ private:
     
     // Tile storage
     std::vector<Tile> tiles;
+    LodColorPyramid lod_color_pyramid; // Built after generation, kept in sync by setTile
+    
+    // Tiles touched by setTile, as an inclusive bounding box per consumer (empty when min > max)
+    struct DirtyTileBox {
+        int min_x, min_y, max_x, max_y;
+    };
+    DirtyTileBox dirty_boxes[static_cast<int>(DirtyTileConsumer::COUNT)];
+    void clearDirtyTileBox(DirtyTileBox& box) const;
     
     // Generation pipeline
     std::vector<std::unique_ptr<Generation::IGenerationStep>> generation_steps;
@@ -79,6 +110,7 @@ private:
     // Helper methods for generation
     void initializeWorldData();
     void runGenerationPipeline();
+    void finalizeTileDisplays();
 };
 
 } // namespace World
\ No newline at end of file
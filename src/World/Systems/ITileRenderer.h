@@ -10,12 +10,23 @@ namespace Systems {
  * Interface for system-specific tile renderers
  * Each terrain system (Rivers, Lakes, Mountains, Land, Vegetation) implements this
  */
+template <size_t N>
+constexpr bool containsTileType(const BaseTileType (&types)[N], BaseTileType tile_type) {
+    for (size_t i = 0; i < N; ++i) {
+        if (types[i] == tile_type) return true;
+    }
+    return false;
+}
+
 class ITileRenderer {
 public:
     virtual ~ITileRenderer() = default;
     
     /**
-     * Check if this renderer can handle the given tile type
+     * Check if this renderer can handle the given tile type.
+     * Implementations answer from their constexpr RENDERED_TYPES list, which also feeds
+     * the compile-time dispatch table in TileRendererDispatch.h. Each implementation
+     * also provides static constexpr isAnimatedType() for the animated-types table.
      */
     virtual bool canRender(BaseTileType tile_type) const = 0;
     
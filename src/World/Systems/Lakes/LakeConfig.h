@@ -34,6 +34,7 @@ const float WAVE_DAMPING = 0.15f;
 const float WAVE_ACCELERATION = 1.2f;
 const float WAVE_VARIATION = 0.3f;
 const float TIDE_CYCLE_TIME = 45.0f;
+const int WAVE_SINE_LUT_SIZE = 4096;          // Entries per turn in the wave sine table (power of two)
 
 // Smooth noise parameters for natural flow
 const float WAVE_FLOW_NOISE_FREQ = 0.005f;
@@ -3,6 +3,7 @@
 #include "../../GenerationSteps/IGenerationStep.h"
 #include "../../../Core/FastNoiseLite.h"
 #include "LakeConfig.h"
+#include <vector>
 
 namespace World {
 namespace Systems {
@@ -14,6 +15,10 @@ public:
     void process(WorldData& world_data, unsigned int base_world_seed, int step_seed_offset) override;
     std::string getName() const override { return "Lake Tile Assigner"; }
 
+    // Assign a precollected list of lake tiles (scan order); neighbourhood checks still read the full map
+    void assignTiles(WorldData& world_data, const std::vector<size_t>& lake_tiles,
+                     unsigned int base_world_seed, int step_seed_offset);
+
 private:
     float water_level_lake_max_height;
     float pond_max_surface_height;
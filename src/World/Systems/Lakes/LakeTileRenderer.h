@@ -3,6 +3,8 @@
 #include "../ITileRenderer.h"
 #include "LakeColors.h"
 #include "LakeConfig.h"
+#include "LakeWavePhases.h"
+#include <vector>
 #include <cmath>
 
 namespace World {
@@ -11,10 +13,18 @@ namespace Lakes {
 
 class LakeTileRenderer : public ITileRenderer {
 public:
+    static constexpr BaseTileType RENDERED_TYPES[] = {
+        BaseTileType::LAKE_WATER,
+        BaseTileType::POND_WATER
+    };
+
     bool canRender(BaseTileType tile_type) const override {
-        return tile_type == BaseTileType::LAKE_WATER || tile_type == BaseTileType::POND_WATER;
+        return containsTileType(RENDERED_TYPES, tile_type);
     }
 
+    // Both lakes and ponds shimmer with global_water_animation_progress
+    static constexpr bool isAnimatedType(BaseTileType) { return true; }
+
     Core::ScreenCell render(
         BaseTileType base_type, 
         float height_val, 
@@ -47,6 +57,31 @@ public:
         return "Lakes";
     }
 
+    /**
+     * Shade many LAKE_WATER cells for one frame. The wave phases are computed once,
+     * then a tight pass over the packed arrays fills total_wave before the visual pass.
+     * out_cells[i] corresponds to batch entry i.
+     */
+    void renderLakeBatch(LakeCellBatch& batch, float global_water_animation_progress,
+                         std::vector<Core::ScreenCell>& out_cells) const {
+        const LakeWavePhases phases = LakeWavePhases::forProgress(global_water_animation_progress);
+        const size_t count = batch.size();
+        
+        batch.total_wave.resize(count);
+        const int* dist = batch.dist_to_land.data();
+        const float* offset = batch.anim_offset.data();
+        const float* strand = batch.strand_intensity.data();
+        float* wave = batch.total_wave.data();
+        for (size_t i = 0; i < count; ++i) {
+            wave[i] = phases.totalWave(dist[i], offset[i], strand[i]);
+        }
+        
+        out_cells.resize(count);
+        for (size_t i = 0; i < count; ++i) {
+            out_cells[i] = determineWaveVisual(wave[i], static_cast<float>(dist[i]), strand[i], offset[i]);
+        }
+    }
+
 private:
     Core::ScreenCell renderPond(float height_val, float global_water_animation_progress, 
                                float tile_anim_offset) const {
@@ -70,53 +105,10 @@ private:
         (void)height_val; // Unused for now
         
         // UNIFIED WATER ANIMATION NETWORK - Seamless shore-to-deep system
-        float shore_distance = static_cast<float>(dist_to_land);
-        
-        // UNIVERSAL WATER ANIMATION - Works at all depths
-        float base_time = global_water_animation_progress * WAVE_SPEED;
-        
-        // Create wave layers that work across entire lake
-        // Layer 1: Primary shore waves (strongest near shore)
-        float shore_wave_intensity = 1.0f;
-        if (shore_distance >= 0) {
-            shore_wave_intensity = std::max(0.2f, 1.0f - (shore_distance / static_cast<float>(WAVE_MAX_DISTANCE_FROM_SHORE)));
-        }
-        
-        // Shore waves flow perpendicular to shore (inward)
-        float shore_wave_phase = base_time - shore_distance * WAVE_FREQUENCY;
-        float shore_wave = std::sin(shore_wave_phase * 2.0f * 3.14159f + tile_anim_offset * 6.28f) * shore_wave_intensity;
-        
-        // Layer 2: Deep water currents (gentle, omnipresent)
-        float deep_current_phase = base_time * 0.3f + tile_anim_offset * 2.0f;
-        float deep_current = std::sin(deep_current_phase * 2.0f * 3.14159f) * 0.4f;
-        
-        // Layer 3: Lake-wide pulses (very slow, affects entire lake)
-        float lake_pulse_phase = base_time * 0.15f + tile_anim_offset * 1.5f;
-        float lake_pulse = std::sin(lake_pulse_phase * 2.0f * 3.14159f) * 0.2f;
-        
-        // Layer 4: Surface texture (fast, subtle)
-        float surface_texture_phase = base_time * 2.0f + tile_anim_offset * 8.0f;
-        float surface_texture = std::sin(surface_texture_phase * 2.0f * 3.14159f) * 0.15f;
-        
-        // SEAMLESS BLENDING - Combine all layers based on depth
-        float total_wave;
-        float wave_strength = tile_wave_strand_intensity;
-        
-        if (shore_distance >= 0 && shore_distance < WAVE_MAX_DISTANCE_FROM_SHORE) {
-            // Near shore: Strong shore waves + background layers
-            total_wave = shore_wave * wave_strength + 
-                       deep_current * 0.3f + 
-                       lake_pulse * 0.5f + 
-                       surface_texture * 0.2f;
-        } else {
-            // Deep water: Gentle currents + lake pulse + surface texture
-            total_wave = deep_current * 0.6f + 
-                       lake_pulse * 0.8f + 
-                       surface_texture * 0.3f +
-                       shore_wave * 0.1f; // Faint shore wave influence
-        }
+        LakeWavePhases phases = LakeWavePhases::forProgress(global_water_animation_progress);
+        float total_wave = phases.totalWave(dist_to_land, tile_anim_offset, tile_wave_strand_intensity);
         
-        return determineWaveVisual(total_wave, shore_distance, wave_strength, tile_anim_offset);
+        return determineWaveVisual(total_wave, static_cast<float>(dist_to_land), tile_wave_strand_intensity, tile_anim_offset);
     }
 
     Core::ScreenCell determineWaveVisual(float total_wave, float shore_distance, 
@@ -0,0 +1,121 @@
+// File: EmergentKingdoms/src/World/Systems/Lakes/LakeWavePhases.h
+#pragma once
+#include "LakeConfig.h"
+#include <array>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+namespace World {
+namespace Systems {
+namespace Lakes {
+
+// ===== SINE LOOKUP (one full turn) =====
+inline std::array<float, WAVE_SINE_LUT_SIZE> buildWaveSineLut() {
+    std::array<float, WAVE_SINE_LUT_SIZE> lut{};
+    for (int i = 0; i < WAVE_SINE_LUT_SIZE; ++i) {
+        lut[i] = std::sin(static_cast<float>(i) / WAVE_SINE_LUT_SIZE * 2.0f * 3.14159265f);
+    }
+    return lut;
+}
+
+inline const std::array<float, WAVE_SINE_LUT_SIZE> WAVE_SINE_LUT = buildWaveSineLut();
+
+// sin(turns * 2*pi) via the lookup table; any finite input
+inline float sinTurns(float turns) {
+    float frac = turns - std::floor(turns);
+    int index = static_cast<int>(frac * WAVE_SINE_LUT_SIZE) & (WAVE_SINE_LUT_SIZE - 1);
+    return WAVE_SINE_LUT[index];
+}
+
+/**
+ * Time-dependent part of the four lake wave layers, computed once per frame.
+ * Each layer is sin(time_phase + per-tile phase), so per cell only the
+ * tile's own phase is added before a table lookup.
+ */
+struct LakeWavePhases {
+    float shore_turns = 0.0f;    // Layer 1: shore waves
+    float deep_turns = 0.0f;     // Layer 2: deep currents
+    float pulse_turns = 0.0f;    // Layer 3: lake-wide pulses
+    float surface_turns = 0.0f;  // Layer 4: surface texture
+
+    static LakeWavePhases forProgress(float global_water_animation_progress) {
+        float base_time = global_water_animation_progress * WAVE_SPEED;
+        LakeWavePhases phases;
+        phases.shore_turns = base_time - std::floor(base_time);
+        phases.deep_turns = base_time * 0.3f - std::floor(base_time * 0.3f);
+        phases.pulse_turns = base_time * 0.15f - std::floor(base_time * 0.15f);
+        phases.surface_turns = base_time * 2.0f - std::floor(base_time * 2.0f);
+        return phases;
+    }
+
+    // Combined wave height for one LAKE_WATER cell
+    float totalWave(int dist_to_land, float tile_anim_offset, float tile_wave_strand_intensity) const {
+        float shore_distance = static_cast<float>(dist_to_land);
+
+        // Layer 1 is strongest near shore and flows inward
+        float shore_wave_intensity = 1.0f;
+        if (shore_distance >= 0) {
+            shore_wave_intensity = std::max(0.2f, 1.0f - (shore_distance / static_cast<float>(WAVE_MAX_DISTANCE_FROM_SHORE)));
+        }
+        float shore_wave = sinTurns(shore_turns - shore_distance * WAVE_FREQUENCY +
+                                    tile_anim_offset * (6.28f / (2.0f * 3.14159f))) * shore_wave_intensity;
+        float deep_current = sinTurns(deep_turns + tile_anim_offset * 2.0f) * 0.4f;
+        float lake_pulse = sinTurns(pulse_turns + tile_anim_offset * 1.5f) * 0.2f;
+        float surface_texture = sinTurns(surface_turns + tile_anim_offset * 8.0f) * 0.15f;
+
+        // Seamless blending of all layers based on depth
+        if (shore_distance >= 0 && shore_distance < WAVE_MAX_DISTANCE_FROM_SHORE) {
+            return shore_wave * tile_wave_strand_intensity +
+                   deep_current * 0.3f +
+                   lake_pulse * 0.5f +
+                   surface_texture * 0.2f;
+        }
+        return deep_current * 0.6f +
+               lake_pulse * 0.8f +
+               surface_texture * 0.3f +
+               shore_wave * 0.1f; // Faint shore wave influence
+    }
+};
+
+/**
+ * Packed LAKE_WATER cells collected during a frame, shaded together by
+ * LakeTileRenderer::renderLakeBatch. cell_slot is an opaque caller id
+ * (e.g. a screen cell index) carried through unchanged.
+ */
+struct LakeCellBatch {
+    std::vector<int> cell_slot;
+    std::vector<int> dist_to_land;
+    std::vector<float> anim_offset;
+    std::vector<float> strand_intensity;
+    std::vector<float> total_wave; // Filled by the batch pass
+
+    void clear() {
+        cell_slot.clear();
+        dist_to_land.clear();
+        anim_offset.clear();
+        strand_intensity.clear();
+        total_wave.clear();
+    }
+
+    void add(int slot, int dist, float offset, float strand) {
+        cell_slot.push_back(slot);
+        dist_to_land.push_back(dist);
+        anim_offset.push_back(offset);
+        strand_intensity.push_back(strand);
+    }
+
+    // Append another batch; used to merge per-thread batches in thread order
+    void append(const LakeCellBatch& other) {
+        cell_slot.insert(cell_slot.end(), other.cell_slot.begin(), other.cell_slot.end());
+        dist_to_land.insert(dist_to_land.end(), other.dist_to_land.begin(), other.dist_to_land.end());
+        anim_offset.insert(anim_offset.end(), other.anim_offset.begin(), other.anim_offset.end());
+        strand_intensity.insert(strand_intensity.end(), other.strand_intensity.begin(), other.strand_intensity.end());
+    }
+
+    size_t size() const { return cell_slot.size(); }
+};
+
+} // namespace Lakes
+} // namespace Systems
+} // namespace World
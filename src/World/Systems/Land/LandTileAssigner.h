@@ -2,6 +2,7 @@
 #pragma once
 #include "../../GenerationSteps/IGenerationStep.h"
 #include "LandConfig.h"
+#include <vector>
 
 namespace World {
 namespace Systems {
@@ -13,6 +14,13 @@ public:
     void process(WorldData& world_data, unsigned int base_world_seed, int step_seed_offset) override;
     std::string getName() const override { return "Land Tile Assigner"; }
 
+    static bool ownsType(BaseTileType type);
+
+    // Assign precollected land tiles; marsh_tiles must be the MARSH subset of land_tiles (scan order)
+    void assignTiles(WorldData& world_data, const std::vector<size_t>& land_tiles,
+                     const std::vector<size_t>& marsh_tiles,
+                     unsigned int base_world_seed, int step_seed_offset);
+
 private:
     float marsh_water_coverage_chance;
 };
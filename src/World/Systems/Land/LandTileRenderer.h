@@ -12,18 +12,25 @@ namespace Land {
 
 class LandTileRenderer : public ITileRenderer {
 public:
+    static constexpr BaseTileType RENDERED_TYPES[] = {
+        BaseTileType::MEADOW,
+        BaseTileType::PLAINS,
+        BaseTileType::DRY_PLAINS,
+        BaseTileType::HILLS,
+        BaseTileType::MOOR,
+        BaseTileType::PLATEAU_GRASS,
+        BaseTileType::MARSH,
+        BaseTileType::BORDER_WALL,
+        BaseTileType::VOID
+    };
+
     bool canRender(BaseTileType tile_type) const override {
-        return tile_type == BaseTileType::MEADOW ||
-               tile_type == BaseTileType::PLAINS ||
-               tile_type == BaseTileType::DRY_PLAINS ||
-               tile_type == BaseTileType::HILLS ||
-               tile_type == BaseTileType::MOOR ||
-               tile_type == BaseTileType::PLATEAU_GRASS ||
-               tile_type == BaseTileType::MARSH ||
-               tile_type == BaseTileType::BORDER_WALL ||
-               tile_type == BaseTileType::VOID;
+        return containsTileType(RENDERED_TYPES, tile_type);
     }
 
+    // Output never depends on global_water_animation_progress
+    static constexpr bool isAnimatedType(BaseTileType) { return false; }
+
     Core::ScreenCell render(
         BaseTileType base_type, 
         float height_val, 
@@ -27,35 +27,11 @@ void MountainTileAssigner::process(WorldData& world_data, unsigned int base_worl
         for (int x = 0; x < world_data.map_width; ++x) {
             size_t index = static_cast<size_t>(y) * world_data.map_width + x;
             
-            // Check if this is a mountain-type tile that we should handle
-            // FIXED: Use getTilesRef() instead of accessing tiles directly
             if (index >= world_data.map_context->getTilesRef().size()) continue;
             
             BaseTileType current_type = world_data.map_context->getTilesRef()[index].base_type;
-            
-            if (current_type == BaseTileType::MOUNTAIN_LOWER ||
-                current_type == BaseTileType::MOUNTAIN_MID ||
-                current_type == BaseTileType::MOUNTAIN_UPPER ||
-                current_type == BaseTileType::MOUNTAIN_PEAK_SNOW ||
-                current_type == BaseTileType::CLIFF_FACE ||
-                current_type == BaseTileType::STEEP_SLOPE ||
-                current_type == BaseTileType::ROCKY_SLOPE) {
-                
-                World::SlopeAspect aspect = (index < world_data.aspect_map.size()) ? 
-                                          world_data.aspect_map[index] : World::SlopeAspect::FLAT;
-                
-                // FIXED: Use getTilesRef() instead of accessing tiles directly
-                world_data.map_context->getTilesRef()[index] = Tile::create(
-                    current_type,
-                    world_data.heightmap_data[index],
-                    world_data.slope_map[index],
-                    aspect,
-                    -1, // distance_to_land (not applicable for mountains)
-                    -1, // distance_to_water (not applicable for mountains)
-                    0.0f, // animation_offset (mountains don't animate)
-                    0.0f, // wave_strand_intensity (not applicable for mountains)
-                    false // is_marsh_water_patch
-                );
+            if (ownsType(current_type)) {
+                assignTile(world_data, index, current_type);
             }
         }
     }
@@ -63,6 +39,33 @@ void MountainTileAssigner::process(WorldData& world_data, unsigned int base_worl
     std::cout << "  Mountains: Finished assigning mountain tiles." << std::endl;
 }
 
+bool MountainTileAssigner::ownsType(BaseTileType type) {
+    return type == BaseTileType::MOUNTAIN_LOWER ||
+           type == BaseTileType::MOUNTAIN_MID ||
+           type == BaseTileType::MOUNTAIN_UPPER ||
+           type == BaseTileType::MOUNTAIN_PEAK_SNOW ||
+           type == BaseTileType::CLIFF_FACE ||
+           type == BaseTileType::STEEP_SLOPE ||
+           type == BaseTileType::ROCKY_SLOPE;
+}
+
+void MountainTileAssigner::assignTile(WorldData& world_data, size_t index, BaseTileType type) const {
+    World::SlopeAspect aspect = (index < world_data.aspect_map.size()) ? 
+                              world_data.aspect_map[index] : World::SlopeAspect::FLAT;
+    
+    world_data.map_context->getTilesRef()[index] = Tile::create(
+        type,
+        world_data.heightmap_data[index],
+        world_data.slope_map[index],
+        aspect,
+        -1, // distance_to_land (not applicable for mountains)
+        -1, // distance_to_water (not applicable for mountains)
+        0.0f, // animation_offset (mountains don't animate)
+        0.0f, // wave_strand_intensity (not applicable for mountains)
+        false // is_marsh_water_patch
+    );
+}
+
 } // namespace Mountains
 } // namespace Systems
 } // namespace World
\ No newline at end of file
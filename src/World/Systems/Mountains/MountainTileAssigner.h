@@ -13,6 +13,11 @@ public:
     void process(WorldData& world_data, unsigned int base_world_seed, int step_seed_offset) override;
     std::string getName() const override { return "Mountain Tile Assigner"; }
 
+    // Mountain tiles need no neighbourhood context, so the fused classification
+    // sweep creates them in place as soon as they are classified
+    static bool ownsType(BaseTileType type);
+    void assignTile(WorldData& world_data, size_t index, BaseTileType type) const;
+
 private:
     float snowline_min_height;
 };
@@ -11,16 +11,23 @@ namespace Mountains {
 
 class MountainTileRenderer : public ITileRenderer {
 public:
+    static constexpr BaseTileType RENDERED_TYPES[] = {
+        BaseTileType::MOUNTAIN_LOWER,
+        BaseTileType::MOUNTAIN_MID,
+        BaseTileType::MOUNTAIN_UPPER,
+        BaseTileType::MOUNTAIN_PEAK_SNOW,
+        BaseTileType::CLIFF_FACE,
+        BaseTileType::STEEP_SLOPE,
+        BaseTileType::ROCKY_SLOPE
+    };
+
     bool canRender(BaseTileType tile_type) const override {
-        return tile_type == BaseTileType::MOUNTAIN_LOWER ||
-               tile_type == BaseTileType::MOUNTAIN_MID ||
-               tile_type == BaseTileType::MOUNTAIN_UPPER ||
-               tile_type == BaseTileType::MOUNTAIN_PEAK_SNOW ||
-               tile_type == BaseTileType::CLIFF_FACE ||
-               tile_type == BaseTileType::STEEP_SLOPE ||
-               tile_type == BaseTileType::ROCKY_SLOPE;
+        return containsTileType(RENDERED_TYPES, tile_type);
     }
 
+    // Output never depends on global_water_animation_progress
+    static constexpr bool isAnimatedType(BaseTileType) { return false; }
+
     Core::ScreenCell render(
         BaseTileType base_type, 
         float height_val, 
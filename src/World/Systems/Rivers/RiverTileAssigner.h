@@ -2,6 +2,7 @@
 #pragma once
 #include "../../GenerationSteps/IGenerationStep.h"
 #include "RiverConfig.h"
+#include <vector>
 
 namespace World {
 namespace Systems {
@@ -13,6 +14,10 @@ public:
     void process(WorldData& world_data, unsigned int base_world_seed, int step_seed_offset) override;
     std::string getName() const override { return "River Tile Assigner"; }
 
+    // Assign a precollected list of river tiles (scan order)
+    void assignTiles(WorldData& world_data, const std::vector<size_t>& river_tiles,
+                     unsigned int base_world_seed, int step_seed_offset);
+
 private:
     float terrain_river_bed_height;
 };
@@ -10,10 +10,17 @@ namespace Rivers {
 
 class RiverTileRenderer : public ITileRenderer {
 public:
+    static constexpr BaseTileType RENDERED_TYPES[] = {
+        BaseTileType::RIVER_WATER
+    };
+
     bool canRender(BaseTileType tile_type) const override {
-        return tile_type == BaseTileType::RIVER_WATER;
+        return containsTileType(RENDERED_TYPES, tile_type);
     }
 
+    // Output never depends on global_water_animation_progress
+    static constexpr bool isAnimatedType(BaseTileType) { return false; }
+
     Core::ScreenCell render(
         BaseTileType base_type, 
         float height_val, 
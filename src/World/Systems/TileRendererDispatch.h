@@ -0,0 +1,116 @@
+// File: EmergentKingdoms/src/World/Systems/TileRendererDispatch.h
+#pragma once
+#include "ITileRenderer.h"
+#include "Rivers/RiverTileRenderer.h"
+#include "Lakes/LakeTileRenderer.h"
+#include "Mountains/MountainTileRenderer.h"
+#include "Land/LandTileRenderer.h"
+#include "Vegetation/VegetationTileRenderer.h"
+#include <array>
+
+namespace World {
+namespace Systems {
+
+/**
+ * Compile-time BaseTileType -> renderer dispatch.
+ * The table is built from each system's RENDERED_TYPES list, and a static_assert
+ * rejects any tile type that has no renderer or more than one.
+ */
+
+using TileRenderFunction = Core::ScreenCell (*)(BaseTileType base_type, float height_val, float slope_val,
+                                                SlopeAspect aspect_val, int dist_to_land,
+                                                float global_water_animation_progress,
+                                                float tile_anim_offset, float tile_wave_strand_intensity,
+                                                bool is_marsh_water_patch_flag, int tile_dist_to_water);
+
+// One shared instance per renderer (all renderers are stateless)
+template <typename RendererT>
+inline const RendererT tile_renderer_instance{};
+
+// Calls through the concrete type, so render() is resolved statically
+template <typename RendererT>
+Core::ScreenCell renderTileWith(BaseTileType base_type, float height_val, float slope_val,
+                                SlopeAspect aspect_val, int dist_to_land,
+                                float global_water_animation_progress,
+                                float tile_anim_offset, float tile_wave_strand_intensity,
+                                bool is_marsh_water_patch_flag, int tile_dist_to_water) {
+    return tile_renderer_instance<RendererT>.RendererT::render(
+        base_type, height_val, slope_val, aspect_val, dist_to_land, global_water_animation_progress,
+        tile_anim_offset, tile_wave_strand_intensity, is_marsh_water_patch_flag, tile_dist_to_water);
+}
+
+template <typename... RendererTs>
+struct TileRendererRegistry {
+    static constexpr std::array<int, BASE_TILE_TYPE_COUNT> ownerCounts() {
+        std::array<int, BASE_TILE_TYPE_COUNT> counts{};
+        (addOwners<RendererTs>(counts), ...);
+        return counts;
+    }
+
+    static constexpr bool everyTypeHasExactlyOneOwner() {
+        std::array<int, BASE_TILE_TYPE_COUNT> counts = ownerCounts();
+        for (size_t i = 0; i < BASE_TILE_TYPE_COUNT; ++i) {
+            if (counts[i] != 1) return false;
+        }
+        return true;
+    }
+
+    static constexpr std::array<TileRenderFunction, BASE_TILE_TYPE_COUNT> buildTable() {
+        std::array<TileRenderFunction, BASE_TILE_TYPE_COUNT> table{};
+        (addEntries<RendererTs>(table), ...);
+        return table;
+    }
+
+    static constexpr std::array<bool, BASE_TILE_TYPE_COUNT> buildAnimatedTable() {
+        std::array<bool, BASE_TILE_TYPE_COUNT> table{};
+        (addAnimated<RendererTs>(table), ...);
+        return table;
+    }
+
+private:
+    template <typename RendererT>
+    static constexpr void addAnimated(std::array<bool, BASE_TILE_TYPE_COUNT>& table) {
+        for (BaseTileType type : RendererT::RENDERED_TYPES) {
+            table[static_cast<size_t>(type)] = RendererT::isAnimatedType(type);
+        }
+    }
+
+    template <typename RendererT>
+    static constexpr void addOwners(std::array<int, BASE_TILE_TYPE_COUNT>& counts) {
+        for (BaseTileType type : RendererT::RENDERED_TYPES) {
+            counts[static_cast<size_t>(type)] += 1;
+        }
+    }
+
+    template <typename RendererT>
+    static constexpr void addEntries(std::array<TileRenderFunction, BASE_TILE_TYPE_COUNT>& table) {
+        for (BaseTileType type : RendererT::RENDERED_TYPES) {
+            table[static_cast<size_t>(type)] = &renderTileWith<RendererT>;
+        }
+    }
+};
+
+using SystemTileRenderers = TileRendererRegistry<
+    Rivers::RiverTileRenderer,
+    Lakes::LakeTileRenderer,
+    Mountains::MountainTileRenderer,
+    Vegetation::VegetationTileRenderer,
+    Land::LandTileRenderer
+>;
+
+static_assert(SystemTileRenderers::everyTypeHasExactlyOneOwner(),
+              "Every BaseTileType must be listed in exactly one system's RENDERED_TYPES");
+
+inline constexpr std::array<TileRenderFunction, BASE_TILE_TYPE_COUNT> TILE_RENDER_TABLE =
+    SystemTileRenderers::buildTable();
+
+// Types whose display changes with the global animation progress; all others can reuse Tile::display_cell
+inline constexpr std::array<bool, BASE_TILE_TYPE_COUNT> TILE_ANIMATED_TABLE =
+    SystemTileRenderers::buildAnimatedTable();
+
+static_assert(TILE_ANIMATED_TABLE[static_cast<size_t>(BaseTileType::LAKE_WATER)] &&
+              !TILE_ANIMATED_TABLE[static_cast<size_t>(BaseTileType::PLAINS)],
+              "Animated-types table out of sync with the system renderers");
+
+} // namespace Systems
+} // namespace World
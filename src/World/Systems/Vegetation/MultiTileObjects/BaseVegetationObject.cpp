@@ -2,18 +2,17 @@
 #include "BaseVegetationObject.h"
 #include "../VegetationColors.h"
 #include "../../../../Core/BaseConfig.h"
+#include "../../../../Core/HashNoise.h"
 #include <algorithm>
 #include <cmath>
-#include <random>
 
 namespace World {
 namespace Systems {
 namespace Vegetation {
 namespace MultiTileObjects {
 
-BaseVegetationObject::BaseVegetationObject(int origin_x, int origin_y, unsigned int seed)
-    : origin_x(origin_x), origin_y(origin_y), width(1), height(1), 
-      random_seed(seed), has_animation(false), current_time(0.0f) {
+BaseVegetationObject::BaseVegetationObject(unsigned int seed)
+    : width(1), height(1), random_seed(seed), has_animation(false) {
 }
 
 void BaseVegetationObject::setDimensions(int w, int h) {
@@ -55,13 +54,8 @@ BaseVegetationObject::ObjectTile& BaseVegetationObject::getTileRef(int x, int y)
 }
 
 BaseVegetationObject::ObjectTile BaseVegetationObject::getTileAt(int relative_x, int relative_y) const {
-    EntityContext defaultContext;
-    return getTileAt(relative_x, relative_y, defaultContext);
-}
-
-BaseVegetationObject::ObjectTile BaseVegetationObject::getTileAt(int relative_x, int relative_y, 
-                                                                 const EntityContext& context) const {
-    if (relative_x < 0 || relative_x >= width || relative_y < 0 || relative_y >= height) {
+    if (relative_x < 0 || relative_x >= width || relative_y < 0 || relative_y >= height ||
+        relative_y >= static_cast<int>(tiles.size()) || relative_x >= static_cast<int>(tiles[relative_y].size())) {
         // Return empty transparent tile - no background artifacts
         ObjectTile empty_tile;
         empty_tile.character = ' ';
@@ -73,76 +67,27 @@ BaseVegetationObject::ObjectTile BaseVegetationObject::getTileAt(int relative_x,
         return empty_tile;
     }
     
-    ObjectTile tile = tiles[relative_y][relative_x];
-    
-    // If there's an entity underneath a canopy tile, show the "under canopy" version
-    if (context.entity_underneath && tile.is_canopy) {
-        // Transform canopy view to underneath view (darker, trunk-like)
-        tile.character = (tile.character == 'T' || tile.character == 'A') ? '|' : '.';
-        tile.foreground = sf::Color(
-            static_cast<sf::Uint8>(tile.foreground.r * 0.4f),
-            static_cast<sf::Uint8>(tile.foreground.g * 0.4f), 
-            static_cast<sf::Uint8>(tile.foreground.b * 0.4f)
-        );
-        tile.background = sf::Color(
-            static_cast<sf::Uint8>(tile.background.r * 0.6f),
-            static_cast<sf::Uint8>(tile.background.g * 0.6f),
-            static_cast<sf::Uint8>(tile.background.b * 0.6f)
-        );
-    }
-    
-    return tile;
-}
-
-std::vector<BaseVegetationObject::ObjectTile> BaseVegetationObject::getAllTiles() const {
-    EntityContext defaultContext;
-    return getAllTiles(defaultContext);
-}
-
-std::vector<BaseVegetationObject::ObjectTile> BaseVegetationObject::getAllTiles(const EntityContext& context) const {
-    std::vector<ObjectTile> all_tiles;
-    all_tiles.reserve(width * height);
-    
-    for (int y = 0; y < height; ++y) {
-        for (int x = 0; x < width; ++x) {
-            EntityContext tile_context = context;
-            // Check if entity is specifically at this tile
-            if (context.entity_underneath) {
-                int world_x = origin_x + x;
-                int world_y = origin_y + y;
-                tile_context.entity_underneath = (context.entity_x == world_x && context.entity_y == world_y);
-            }
-            all_tiles.push_back(getTileAt(x, y, tile_context));
-        }
-    }
-    
-    return all_tiles;
-}
-
-bool BaseVegetationObject::containsPoint(int world_x, int world_y) const {
-    return (world_x >= origin_x && world_x < origin_x + width &&
-            world_y >= origin_y && world_y < origin_y + height);
+    return tiles[relative_y][relative_x];
 }
 
-bool BaseVegetationObject::overlaps(const BaseVegetationObject& other) const {
-    return !(origin_x + width <= other.origin_x || 
-             other.origin_x + other.width <= origin_x ||
-             origin_y + height <= other.origin_y ||
-             other.origin_y + other.height <= origin_y);
+void BaseVegetationObject::releasePatternTiles() {
+    std::vector<std::vector<ObjectTile>>().swap(tiles);
 }
 
 sf::Color BaseVegetationObject::varyColor(const sf::Color& base, float variation) const {
-    std::mt19937 rng(random_seed);
-    std::uniform_real_distribution<float> dist(-variation, variation);
+    // One hash per channel; the same object always gets the same variation
+    auto channelOffset = [this, variation](int channel) {
+        return Core::HashNoise::toSignedFloat(Core::HashNoise::hash1D(random_seed, channel)) * variation * 255.0f;
+    };
     
     auto clamp = [](float val) -> sf::Uint8 {
         return static_cast<sf::Uint8>(std::max(0.0f, std::min(255.0f, val)));
     };
     
     return sf::Color(
-        clamp(base.r + dist(rng) * 255.0f),
-        clamp(base.g + dist(rng) * 255.0f),
-        clamp(base.b + dist(rng) * 255.0f),
+        clamp(base.r + channelOffset(0)),
+        clamp(base.g + channelOffset(1)),
+        clamp(base.b + channelOffset(2)),
         base.a // Preserve alpha
     );
 }
@@ -150,40 +95,40 @@ sf::Color BaseVegetationObject::varyColor(const sf::Color& base, float variation
 char BaseVegetationObject::selectCharFromSet(const std::string& charset, int x, int y) const {
     if (charset.empty()) return ' ';
     
-    std::mt19937 rng(random_seed + x * 1000 + y);
-    std::uniform_int_distribution<size_t> dist(0, charset.size() - 1);
-    return charset[dist(rng)];
+    return charset[Core::HashNoise::hash2D(random_seed, x, y) % charset.size()];
 }
 
 float BaseVegetationObject::getProceduralNoise(int x, int y, float frequency) const {
     // Simple noise function for procedural variation
-    unsigned int seed = random_seed + x * 73856093 + y * 19349663;
-    std::mt19937 rng(seed);
-    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
-    
-    float noise = dist(rng);
+    float noise = Core::HashNoise::toSignedFloat(Core::HashNoise::hash2D(random_seed, x, y));
     return std::sin(noise * frequency) * 0.5f + 0.5f; // Normalize to 0-1
 }
 
-void BaseVegetationObject::applyWindEffect(int x, int y, float wind_strength, int wind_direction) {
-    if (x < 0 || x >= width || y < 0 || y >= height) return;
-    
-    ObjectTile& tile = tiles[y][x];
-    
+float BaseVegetationObject::getValueNoise(float x, float y, float frequency) const {
+    return Core::HashNoise::valueNoise2D(random_seed, x * frequency, y * frequency);
+}
+
+void BaseVegetationObject::animateTile(Core::ScreenCell& /* cell */, int /* relative_x */, int /* relative_y */,
+                                       bool /* is_canopy */, float /* time_seconds */,
+                                       float /* wind_strength */) const {
+    // Static objects keep their baked pattern
+}
+
+void BaseVegetationObject::applyWindEffect(Core::ScreenCell& cell, float wind_strength, int wind_direction) const {
     // Wind affects character choice and color
     if (wind_strength > 0.3f) {
         // Strong wind - bend characters
-        if (tile.character == '|') tile.character = (wind_direction % 2 == 0) ? '/' : '\\';
-        if (tile.character == '^') tile.character = (wind_direction % 2 == 0) ? '>' : '<';
+        if (cell.character == '|') cell.character = (wind_direction % 2 == 0) ? '/' : '\\';
+        if (cell.character == '^') cell.character = (wind_direction % 2 == 0) ? '>' : '<';
     }
     
     // Wind affects color intensity (lighter when swaying)
     float color_intensity = 1.0f + wind_strength * 0.2f;
-    tile.foreground = sf::Color(
-        static_cast<sf::Uint8>(std::min(255.0f, tile.foreground.r * color_intensity)),
-        static_cast<sf::Uint8>(std::min(255.0f, tile.foreground.g * color_intensity)),
-        static_cast<sf::Uint8>(std::min(255.0f, tile.foreground.b * color_intensity)),
-        tile.foreground.a
+    cell.fg_color = sf::Color(
+        static_cast<sf::Uint8>(std::min(255.0f, cell.fg_color.r * color_intensity)),
+        static_cast<sf::Uint8>(std::min(255.0f, cell.fg_color.g * color_intensity)),
+        static_cast<sf::Uint8>(std::min(255.0f, cell.fg_color.b * color_intensity)),
+        cell.fg_color.a
     );
 }
 
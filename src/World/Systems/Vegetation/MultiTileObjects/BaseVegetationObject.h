@@ -14,6 +14,11 @@ namespace MultiTileObjects {
  * Abstract base class for all multi-tile vegetation objects
  * Provides framework for trees, boulders, grass fields, etc.
  * Optimized for beautiful top-down view with no visual artifacts
+ *
+ * Objects are shared prototypes (flyweights): each one generates a single pattern
+ * variant that is baked into the VegetationPatternAtlas, after which its own tile
+ * grid is released. Placed instances only store origin, pattern id and tint.
+ * Animation is evaluated per visible cell by animateTile() and never written back.
  */
 class BaseVegetationObject {
 public:
@@ -27,47 +32,40 @@ public:
         float animation_phase = 0.0f;                         // For animated effects
     };
 
-    struct EntityContext {
-        bool entity_underneath = false;        // Is there an entity under this tile?
-        int entity_x = -1, entity_y = -1;     // Entity position if present
-    };
-
-    BaseVegetationObject(int origin_x, int origin_y, unsigned int seed);
+    explicit BaseVegetationObject(unsigned int seed);
     virtual ~BaseVegetationObject() = default;
 
     // Pure virtual methods - must be implemented by derived classes
-    virtual void generatePattern() = 0;                          // Create the object's tile pattern
-    virtual void updateAnimation(float time_delta) = 0;          // Update animations
+    // Create the object's tile pattern. Not called by constructors; touches only this object's
+    // state, so prototypes may generate concurrently
+    virtual void generatePattern() = 0;
     virtual std::string getObjectType() const = 0;              // Get type name for debugging
     virtual bool canPlaceAt(int world_x, int world_y, 
                            const std::vector<float>& heightmap,
                            const std::vector<float>& slope_map,
                            int map_width, int map_height) const = 0; // Check if placement is valid
+    
+    // Animate one cell of the baked pattern at read time. A pure function of the pattern
+    // tile, time and wind: nothing is stored, so off-screen objects cost nothing and colours
+    // cannot drift. Only called when isAnimated(); the default leaves the cell unchanged
+    virtual void animateTile(Core::ScreenCell& cell, int relative_x, int relative_y, bool is_canopy,
+                             float time_seconds, float wind_strength) const;
 
-    // Common functionality
+    // Common functionality (generated pattern, valid until releasePatternTiles())
     ObjectTile getTileAt(int relative_x, int relative_y) const;
-    ObjectTile getTileAt(int relative_x, int relative_y, const EntityContext& context) const;
-    std::vector<ObjectTile> getAllTiles() const;
-    std::vector<ObjectTile> getAllTiles(const EntityContext& context) const;
+    // Drop the per-object tile grid once the pattern has been baked into the atlas
+    void releasePatternTiles();
     
     // Getters
-    int getOriginX() const { return origin_x; }
-    int getOriginY() const { return origin_y; }
     int getWidth() const { return width; }
     int getHeight() const { return height; }
     bool isAnimated() const { return has_animation; }
-    
-    // Bounds checking
-    bool containsPoint(int world_x, int world_y) const;
-    bool overlaps(const BaseVegetationObject& other) const;
 
 protected:
     // Object properties
-    int origin_x, origin_y;             // World coordinates of object origin
     int width, height;                  // Object dimensions
     unsigned int random_seed;           // Seed for procedural generation
     bool has_animation;                 // Does this object animate?
-    float current_time;                 // Current animation time
     
     // Tile data
     std::vector<std::vector<ObjectTile>> tiles; // [y][x] grid of tiles
@@ -78,13 +76,14 @@ protected:
                 bool blocks = false, bool canopy = false);
     ObjectTile& getTileRef(int x, int y);
     
-    // Procedural generation helpers
+    // Procedural generation helpers (stateless hashes of random_seed, see Core/HashNoise.h)
     sf::Color varyColor(const sf::Color& base, float variation) const;
     char selectCharFromSet(const std::string& charset, int x, int y) const;
-    float getProceduralNoise(int x, int y, float frequency = 1.0f) const;
+    float getProceduralNoise(int x, int y, float frequency = 1.0f) const;   // Independent per tile, 0-1
+    float getValueNoise(float x, float y, float frequency = 1.0f) const;    // Smooth across tiles, 0-1
     
     // Animation helpers
-    void applyWindEffect(int x, int y, float wind_strength, int wind_direction);
+    void applyWindEffect(Core::ScreenCell& cell, float wind_strength, int wind_direction) const;
     sf::Color interpolateSeasonalColor(const sf::Color& summer, const sf::Color& autumn, 
                                       float seasonal_factor) const;
 
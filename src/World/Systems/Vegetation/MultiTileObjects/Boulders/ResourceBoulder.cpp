@@ -10,10 +10,8 @@ namespace Vegetation {
 namespace MultiTileObjects {
 namespace Boulders {
 
-ResourceBoulder::ResourceBoulder(int origin_x, int origin_y, unsigned int seed, 
-                                BoulderSize size, ResourceType resource)
-    : BaseVegetationObject(origin_x, origin_y, seed), sparkle_phase(0.0f), 
-      moss_growth_phase(0.0f), resource_type(resource), boulder_size(size) {
+ResourceBoulder::ResourceBoulder(unsigned int seed, BoulderSize size, ResourceType resource)
+    : BaseVegetationObject(seed), resource_type(resource), boulder_size(size) {
     
     // Set dimensions based on boulder size
     int size_tiles = getSizeInTiles(size);
@@ -24,7 +22,7 @@ ResourceBoulder::ResourceBoulder(int origin_x, int origin_y, unsigned int seed,
     // Initialize boulder parameters
     determineBoulderSize();
     
-    generatePattern();
+    // Pattern tiles are built later by generatePattern(), see VegetationObjectManager::buildPatternAtlas
 }
 
 void ResourceBoulder::determineBoulderSize() {
@@ -101,7 +99,8 @@ void ResourceBoulder::generateNaturalBoulderShape() {
             // Add organic irregularity for natural boulder shape
             float angle = std::atan2(dy, dx);
             float irregularity = std::sin(angle * 3.0f) * 0.3f + std::sin(angle * 5.0f) * 0.2f;
-            float effective_radius = radius * (0.85f + irregularity + getProceduralNoise(x, y, 0.2f) * 0.3f);
+            // Smooth noise (same 0.12-0.18 band as before) so the outline has no per-tile speckle
+            float effective_radius = radius * (0.85f + irregularity + 0.12f + getValueNoise(x, y, 0.35f) * 0.06f);
             
             if (distance <= effective_radius) {
                 // Determine boulder surface type based on distance from center
@@ -346,39 +345,18 @@ sf::Color ResourceBoulder::getMossColor(int x, int y) const {
     return varied_moss;
 }
 
-void ResourceBoulder::updateAnimation(float time_delta) {
+void ResourceBoulder::animateTile(Core::ScreenCell& cell, int relative_x, int relative_y,
+                                  bool /* is_canopy */, float time_seconds, float /* wind_strength */) const {
     if (resource_type == ResourceType::NONE) return;
+    if (cell.character != selectResourceCharacter(resource_type)) return;
     
-    current_time += time_delta;
-    updateResourceSparkle(time_delta);
-    updateMossGrowth(time_delta);
-}
-
-void ResourceBoulder::updateResourceSparkle(float time_delta) {
-    sparkle_phase += time_delta;
-    
-    // Update sparkle effects on resource tiles
-    for (int y = 0; y < height; ++y) {
-        for (int x = 0; x < width; ++x) {
-            ObjectTile& tile = getTileRef(x, y);
-            if (tile.character == selectResourceCharacter(resource_type)) {
-                // Occasional sparkle effect
-                float sparkle_intensity = std::sin(sparkle_phase * 2.0f + x + y) * 0.5f + 0.5f;
-                if (sparkle_intensity > 0.8f) {
-                    tile.foreground = getResourceColor(resource_type, true);
-                } else {
-                    tile.foreground = getResourceColor(resource_type, false);
-                }
-            }
-        }
+    // Occasional sparkle effect on resource tiles
+    float sparkle_intensity = std::sin(time_seconds * 2.0f + relative_x + relative_y) * 0.5f + 0.5f;
+    if (sparkle_intensity > 0.8f) {
+        cell.fg_color = getResourceColor(resource_type, true);
     }
 }
 
-void ResourceBoulder::updateMossGrowth(float /* time_delta */) {
-    // Moss slowly grows over time - very subtle animation
-    moss_growth_phase = current_time * 0.1f;
-}
-
 bool ResourceBoulder::canPlaceAt(int world_x, int world_y, 
                                 const std::vector<float>& heightmap,
                                 const std::vector<float>& slope_map,
@@ -31,12 +31,13 @@ public:
         MASSIVE     // 30x30
     };
     
-    ResourceBoulder(int origin_x, int origin_y, unsigned int seed, 
-                   BoulderSize size = BoulderSize::MEDIUM, 
-                   ResourceType resource = ResourceType::NONE);
+    explicit ResourceBoulder(unsigned int seed, 
+                             BoulderSize size = BoulderSize::MEDIUM, 
+                             ResourceType resource = ResourceType::NONE);
     
     void generatePattern() override;
-    void updateAnimation(float time_delta) override;
+    void animateTile(Core::ScreenCell& cell, int relative_x, int relative_y, bool is_canopy,
+                     float time_seconds, float wind_strength) const override;
     std::string getObjectType() const override { return "Resource Boulder"; }
     
     bool canPlaceAt(int world_x, int world_y, 
@@ -63,10 +64,6 @@ private:
     };
     BoulderParams params;
     
-    // Animation state
-    float sparkle_phase;           // For animated resource glints
-    float moss_growth_phase;       // Moss slowly spreads over time
-    
     // Boulder generation - optimized for beautiful top-down view
     void determineBoulderSize();
     void generateNaturalBoulderShape();
@@ -82,10 +79,6 @@ private:
     void addMossPatch(int center_x, int center_y, int radius);
     bool shouldHaveMoss(int x, int y, int center_x, int center_y, int radius) const;
     
-    // Animation methods
-    void updateResourceSparkle(float time_delta);
-    void updateMossGrowth(float time_delta);
-    
     // Visual methods - create rich, natural appearance without artifacts
     char selectBoulderCharacter(int x, int y, float distance_factor) const;
     char selectResourceCharacter(ResourceType type) const;
@@ -10,8 +10,8 @@ namespace Vegetation {
 namespace MultiTileObjects {
 namespace Trees {
 
-AncientOakTree::AncientOakTree(int origin_x, int origin_y, unsigned int seed)
-    : BaseVegetationObject(origin_x, origin_y, seed), wind_sway_phase(0.0f), seasonal_factor(0.0f) {
+AncientOakTree::AncientOakTree(unsigned int seed)
+    : BaseVegetationObject(seed) {
     
     // Set up as a large 15x15 tree
     setDimensions(15, 15);
@@ -29,13 +29,8 @@ AncientOakTree::AncientOakTree(int origin_x, int origin_y, unsigned int seed)
     // Rich, lush colors for beautiful canopy
     params.trunk_color = varyColor(Colors::ANCIENT_OAK_TRUNK, 0.1f);
     params.leaf_color_summer = varyColor(Colors::ANCIENT_OAK_CANOPY, 0.08f);
-    params.leaf_color_autumn = sf::Color(
-        static_cast<sf::Uint8>(std::min(255.0f, params.leaf_color_summer.r * 1.2f)),
-        static_cast<sf::Uint8>(params.leaf_color_summer.g * 0.8f), 
-        static_cast<sf::Uint8>(params.leaf_color_summer.b * 0.4f)
-    );
     
-    generatePattern();
+    // Pattern tiles are built later by generatePattern(), see VegetationObjectManager::buildPatternAtlas
 }
 
 void AncientOakTree::generatePattern() {
@@ -213,9 +208,8 @@ char AncientOakTree::selectTrunkCharacter(int x, int y) const {
 }
 
 sf::Color AncientOakTree::getLushLeafColor(int x, int y, float distance_factor) const {
-    // Create rich, lush leaf colors with depth
-    sf::Color base_color = interpolateSeasonalColor(params.leaf_color_summer, 
-                                                   params.leaf_color_autumn, seasonal_factor);
+    // Create rich, lush leaf colors with depth (baked in summer colours)
+    sf::Color base_color = params.leaf_color_summer;
     
     // Add position-based variation for natural appearance
     float position_variation = getProceduralNoise(x, y, 0.3f) * 0.1f - 0.05f;
@@ -287,27 +281,23 @@ sf::Color AncientOakTree::getGroundBackground() const {
     return sf::Color(40, 50, 30);
 }
 
-void AncientOakTree::updateAnimation(float time_delta) {
-    current_time += time_delta;
+void AncientOakTree::animateTile(Core::ScreenCell& cell, int /* relative_x */, int /* relative_y */,
+                                 bool is_canopy, float time_seconds, float wind_strength) const {
+    if (!is_canopy) return;
+    
+    // Seasonal color changes (very slow): shift the baked summer leaf toward its autumn tone
+    float seasonal_factor = (std::sin(time_seconds * 0.01f) + 1.0f) * 0.5f; // Cycles over ~10 minutes
+    sf::Color autumn_color(
+        static_cast<sf::Uint8>(std::min(255.0f, cell.fg_color.r * 1.2f)),
+        static_cast<sf::Uint8>(cell.fg_color.g * 0.8f),
+        static_cast<sf::Uint8>(cell.fg_color.b * 0.4f),
+        cell.fg_color.a
+    );
+    cell.fg_color = interpolateSeasonalColor(cell.fg_color, autumn_color, seasonal_factor);
     
     // Wind sway effect (gentle for large trees)
-    wind_sway_phase = std::sin(current_time * 0.5f) * 0.3f; // Slow, gentle sway
-    
-    // Seasonal color changes (very slow)
-    seasonal_factor = (std::sin(current_time * 0.01f) + 1.0f) * 0.5f; // Cycles over ~10 minutes
-    
-    // Apply wind effects to canopy tiles
-    float wind_strength = std::abs(wind_sway_phase);
-    int wind_direction = (wind_sway_phase > 0) ? 1 : 0;
-    
-    for (int y = 0; y < height; ++y) {
-        for (int x = 0; x < width; ++x) {
-            ObjectTile& tile = getTileRef(x, y);
-            if (tile.is_canopy) {
-                applyWindEffect(x, y, wind_strength, wind_direction);
-            }
-        }
-    }
+    float wind_sway_phase = std::sin(time_seconds * 0.5f) * 0.3f * wind_strength; // Slow, gentle sway
+    applyWindEffect(cell, std::abs(wind_sway_phase), (wind_sway_phase > 0) ? 1 : 0);
 }
 
 bool AncientOakTree::canPlaceAt(int world_x, int world_y, 
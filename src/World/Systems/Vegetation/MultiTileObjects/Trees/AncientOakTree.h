@@ -16,10 +16,11 @@ namespace Trees {
  */
 class AncientOakTree : public BaseVegetationObject {
 public:
-    AncientOakTree(int origin_x, int origin_y, unsigned int seed);
+    explicit AncientOakTree(unsigned int seed);
     
     void generatePattern() override;
-    void updateAnimation(float time_delta) override;
+    void animateTile(Core::ScreenCell& cell, int relative_x, int relative_y, bool is_canopy,
+                     float time_seconds, float wind_strength) const override;
     std::string getObjectType() const override { return "Ancient Oak"; }
     
     bool canPlaceAt(int world_x, int world_y, 
@@ -35,15 +36,10 @@ private:
         float canopy_density;       // How dense the leaves are (0-1)
         float trunk_irregularity;   // How irregular the trunk shape is
         sf::Color trunk_color;      // Base trunk color
-        sf::Color leaf_color_summer; // Summer leaf color
-        sf::Color leaf_color_autumn; // Autumn leaf color
+        sf::Color leaf_color_summer; // Summer leaf color (autumn is applied in animateTile)
     };
     TreeParams params;
     
-    // Animation state
-    float wind_sway_phase;
-    float seasonal_factor;      // 0=summer, 1=autumn
-    
     // Generation methods - optimized for bushy appearance
     void generateDenseBushyCanopy();
     void generateVisibleTrunk();
@@ -10,8 +10,8 @@ namespace Vegetation {
 namespace MultiTileObjects {
 namespace Trees {
 
-YoungTree::YoungTree(int origin_x, int origin_y, unsigned int seed)
-    : BaseVegetationObject(origin_x, origin_y, seed), wind_sway_phase(0.0f), growth_animation(0.0f) {
+YoungTree::YoungTree(unsigned int seed)
+    : BaseVegetationObject(seed) {
     
     // Set up as a smaller 6x6 tree (increased from 4x4 for better appearance)
     setDimensions(6, 6);
@@ -20,7 +20,7 @@ YoungTree::YoungTree(int origin_x, int origin_y, unsigned int seed)
     // Determine what type of young tree this is
     determineTreeType();
     
-    generatePattern();
+    // Pattern tiles are built later by generatePattern(), see VegetationObjectManager::buildPatternAtlas
 }
 
 void YoungTree::determineTreeType() {
@@ -173,9 +173,6 @@ sf::Color YoungTree::getAnimatedLeafColor(int /* x */, int /* y */, float distan
     // Young trees have vibrant, healthy colors
     sf::Color base_color = params.leaf_color;
     
-    // Growth animation affects brightness
-    float growth_brightness = 1.0f + growth_animation * 0.15f;
-    
     // Add depth - inner areas darker, edges lighter
     sf::Color deep_leaves = sf::Color(
         static_cast<sf::Uint8>(base_color.r * 0.8f),
@@ -183,9 +180,9 @@ sf::Color YoungTree::getAnimatedLeafColor(int /* x */, int /* y */, float distan
         static_cast<sf::Uint8>(base_color.b * 0.7f)
     );
     sf::Color bright_leaves = sf::Color(
-        static_cast<sf::Uint8>(std::min(255.0f, base_color.r * 1.2f * growth_brightness)),
-        static_cast<sf::Uint8>(std::min(255.0f, base_color.g * 1.1f * growth_brightness)),
-        static_cast<sf::Uint8>(std::min(255.0f, base_color.b * 1.0f * growth_brightness))
+        static_cast<sf::Uint8>(std::min(255.0f, base_color.r * 1.2f)),
+        static_cast<sf::Uint8>(std::min(255.0f, base_color.g * 1.1f)),
+        static_cast<sf::Uint8>(std::min(255.0f, base_color.b * 1.0f))
     );
     
     return Tile::interpolateColor(deep_leaves, bright_leaves, distance_factor);
@@ -212,34 +209,23 @@ sf::Color YoungTree::getTrunkBackground() const {
     return sf::Color(50, 40, 30);
 }
 
-void YoungTree::updateAnimation(float time_delta) {
-    current_time += time_delta;
+void YoungTree::animateTile(Core::ScreenCell& cell, int /* relative_x */, int /* relative_y */,
+                            bool is_canopy, float time_seconds, float wind_strength) const {
+    if (!is_canopy) return;
     
-    updateWindSway(time_delta);
-    updateGrowthAnimation(time_delta);
-    
-    // Apply wind effects to canopy tiles
-    float wind_strength = std::abs(wind_sway_phase) * params.wind_sensitivity;
-    int wind_direction = (wind_sway_phase > 0) ? 1 : 0;
+    // Gentle growth animation (pulsing brightness)
+    float growth_animation = (std::sin(time_seconds * 0.3f) + 1.0f) * 0.5f;
+    float growth_brightness = 1.0f + growth_animation * 0.15f;
+    cell.fg_color = sf::Color(
+        static_cast<sf::Uint8>(std::min(255.0f, cell.fg_color.r * growth_brightness)),
+        static_cast<sf::Uint8>(std::min(255.0f, cell.fg_color.g * growth_brightness)),
+        static_cast<sf::Uint8>(std::min(255.0f, cell.fg_color.b * growth_brightness)),
+        cell.fg_color.a
+    );
     
-    for (int y = 0; y < height; ++y) {
-        for (int x = 0; x < width; ++x) {
-            ObjectTile& tile = getTileRef(x, y);
-            if (tile.is_canopy) {
-                applyWindEffect(x, y, wind_strength, wind_direction);
-            }
-        }
-    }
-}
-
-void YoungTree::updateWindSway(float /* time_delta */) {
     // Young trees sway more dramatically than ancient ones
-    wind_sway_phase = std::sin(current_time * 1.5f) * params.wind_sensitivity;
-}
-
-void YoungTree::updateGrowthAnimation(float /* time_delta */) {
-    // Gentle growth animation (pulsing)
-    growth_animation = (std::sin(current_time * 0.3f) + 1.0f) * 0.5f;
+    float wind_sway_phase = std::sin(time_seconds * 1.5f) * params.wind_sensitivity * wind_strength;
+    applyWindEffect(cell, std::abs(wind_sway_phase) * params.wind_sensitivity, (wind_sway_phase > 0) ? 1 : 0);
 }
 
 bool YoungTree::canPlaceAt(int world_x, int world_y, 
@@ -16,10 +16,11 @@ namespace Trees {
  */
 class YoungTree : public BaseVegetationObject {
 public:
-    YoungTree(int origin_x, int origin_y, unsigned int seed);
+    explicit YoungTree(unsigned int seed);
     
     void generatePattern() override;
-    void updateAnimation(float time_delta) override;
+    void animateTile(Core::ScreenCell& cell, int relative_x, int relative_y, bool is_canopy,
+                     float time_seconds, float wind_strength) const override;
     std::string getObjectType() const override { return "Young Tree"; }
     
     bool canPlaceAt(int world_x, int world_y, 
@@ -46,20 +47,12 @@ private:
     };
     YoungTreeParams params;
     
-    // Animation state
-    float wind_sway_phase;
-    float growth_animation;
-    
     // Generation methods
     void determineTreeType();
     void generateBushyCanopy();
     void generateTrunk();
     void addCanopyCircle(int center_x, int center_y, int radius, float density);
     
-    // Animation methods
-    void updateWindSway(float time_delta);
-    void updateGrowthAnimation(float time_delta);
-    
     // Utility methods for dense, attractive appearance
     char selectDenseCanopyChar(int x, int y, float density) const;
     sf::Color getAnimatedLeafColor(int x, int y, float distance_factor) const;
@@ -3,10 +3,14 @@
 #include "Trees/AncientOakTree.h"
 #include "Trees/YoungTree.h"
 #include "Boulders/ResourceBoulder.h"
+#include "../VegetationGenerator.h"
+#include "../VegetationConfig.h"
 #include <iostream>
 #include <random>
 #include <algorithm>
 #include <map>
+#include <cmath>
+#include <omp.h>
 
 namespace World {
 namespace Systems {
@@ -24,22 +28,81 @@ VegetationObjectManager::VegetationObjectManager() {
     config.resource_boulder_chance = 0.5f; // Good resource opportunities
 }
 
-void VegetationObjectManager::generateObjects(WorldData& world_data, unsigned int base_seed) {
+void VegetationObjectManager::generateObjects(WorldData& world_data, unsigned int base_seed,
+                                              const VegetationGenerator& density) {
     clear();
+    resetPlacementGrid(world_data.map_width, world_data.map_height);
     
     std::cout << "    Multi-Tile Objects: Generating optimized medieval landscape..." << std::endl;
     
+    // Shared pattern variants first; placement only picks among them
+    buildPatternAtlas(base_seed + 3000);
+    
     // OPTIMIZED: Generate in parallel where possible, simpler algorithms
-    generateOptimizedBoulders(world_data, base_seed + 1000);
-    generateOptimizedTrees(world_data, base_seed + 2000);
+    generateOptimizedBoulders(world_data, base_seed + 1000, density);
+    generateOptimizedTrees(world_data, base_seed + 2000, density);
     
-    // Rebuild spatial index for fast lookups
+    // Rebuild spatial index and object-id raster for fast lookups
     rebuildSpatialIndex();
+    rebuildObjectIdRaster(world_data.map_width, world_data.map_height);
     
     printStats();
 }
 
-void VegetationObjectManager::generateOptimizedBoulders(WorldData& world_data, unsigned int seed) {
+void VegetationObjectManager::buildPatternAtlas(unsigned int seed) {
+    // Step 1 (serial): every variant's parameters, in the layout createPatternPrototypes documents
+    prototypes = createPatternPrototypes(seed);
+    ancient_oak_first_pattern = 0;
+    young_tree_first_pattern = static_cast<std::uint16_t>(PATTERN_VARIANTS);
+    boulder_first_pattern = static_cast<std::uint16_t>(2 * PATTERN_VARIANTS);
+    
+    // Step 2 (parallel): build the canopy/stone patterns. Each prototype seeds its own
+    // generators, so the result does not depend on thread count or scheduling
+    int prototype_count = static_cast<int>(prototypes.size());
+    #pragma omp parallel for schedule(dynamic)
+    for (int i = 0; i < prototype_count; ++i) {
+        prototypes[i]->generatePattern();
+    }
+    
+    // Step 3 (serial): bake in id order and drop the per-prototype tile grids
+    for (auto& prototype : prototypes) {
+        pattern_atlas.addPattern(*prototype);
+        prototype->releasePatternTiles();
+    }
+}
+
+std::vector<std::unique_ptr<BaseVegetationObject>> VegetationObjectManager::createPatternPrototypes(unsigned int seed) {
+    // One seeded stream decides every variant, so the atlas layout and pattern ids are deterministic
+    std::mt19937 rng(seed);
+    std::vector<std::unique_ptr<BaseVegetationObject>> variants;
+    
+    for (int variant = 0; variant < PATTERN_VARIANTS; ++variant) {
+        variants.push_back(std::make_unique<Trees::AncientOakTree>(rng()));
+    }
+    for (int variant = 0; variant < PATTERN_VARIANTS; ++variant) {
+        variants.push_back(std::make_unique<Trees::YoungTree>(rng()));
+    }
+    for (int size = 0; size < BOULDER_SIZE_COUNT; ++size) {
+        for (int resource = 0; resource < BOULDER_RESOURCE_COUNT; ++resource) {
+            for (int variant = 0; variant < PATTERN_VARIANTS; ++variant) {
+                variants.push_back(std::make_unique<Boulders::ResourceBoulder>(
+                    rng(), static_cast<Boulders::ResourceBoulder::BoulderSize>(size),
+                    static_cast<Boulders::ResourceBoulder::ResourceType>(resource)));
+            }
+        }
+    }
+    return variants;
+}
+
+std::uint16_t VegetationObjectManager::getBoulderPatternId(Boulders::ResourceBoulder::BoulderSize size,
+                                                           Boulders::ResourceBoulder::ResourceType resource,
+                                                           int variant) const {
+    int family = static_cast<int>(size) * BOULDER_RESOURCE_COUNT + static_cast<int>(resource);
+    return static_cast<std::uint16_t>(boulder_first_pattern + family * PATTERN_VARIANTS + variant);
+}
+
+void VegetationObjectManager::generateOptimizedBoulders(WorldData& world_data, unsigned int seed,
+                                                        const VegetationGenerator& density) {
     std::mt19937 rng(seed);
     std::uniform_real_distribution<float> dist_0_1(0.0f, 1.0f);
     
@@ -66,10 +129,14 @@ void VegetationObjectManager::generateOptimizedBoulders(WorldData& world_data, u
             boulder_x = std::max(15, std::min(boulder_x, world_data.map_width - 35));
             boulder_y = std::max(15, std::min(boulder_y, world_data.map_height - 35));
             
-            // Quick terrain check
-            if (isValidBoulderLocation(boulder_x, boulder_y, world_data)) {
-                // Determine boulder properties
-                float size_roll = dist_0_1(rng);
+            // Quick terrain check; smooth ground with little rock stays clear
+            float rock_placement = density.getRockPlacement(boulder_x, boulder_y);
+            if (rock_placement >= BOULDER_MIN_ROCK_PLACEMENT &&
+                isValidBoulderLocation(boulder_x, boulder_y, world_data)) {
+                // Determine boulder properties; half the size roll is the rockiness of the ground,
+                // saturating at BOULDER_SIZE_FULL_ROCK_PLACEMENT, so rocky ground grows bigger boulders
+                float rockiness = std::min(0.999f, rock_placement / BOULDER_SIZE_FULL_ROCK_PLACEMENT);
+                float size_roll = 0.5f * dist_0_1(rng) + 0.5f * rockiness;
                 Boulders::ResourceBoulder::BoulderSize size;
                 if (size_roll < 0.2f) size = Boulders::ResourceBoulder::BoulderSize::SMALL;
                 else if (size_roll < 0.5f) size = Boulders::ResourceBoulder::BoulderSize::MEDIUM;
@@ -78,7 +145,7 @@ void VegetationObjectManager::generateOptimizedBoulders(WorldData& world_data, u
                 
                 // Determine resources
                 Boulders::ResourceBoulder::ResourceType resource = Boulders::ResourceBoulder::ResourceType::NONE;
-                if (dist_0_1(rng) < config.resource_boulder_chance) {
+                if (dist_0_1(rng) < config.resource_boulder_chance * density.getResourcePlacement(boulder_x, boulder_y)) {
                     float resource_roll = dist_0_1(rng);
                     if (resource_roll < 0.1f) {
                         resource = Boulders::ResourceBoulder::ResourceType::GOLD_VEINS;
@@ -91,11 +158,12 @@ void VegetationObjectManager::generateOptimizedBoulders(WorldData& world_data, u
                     }
                 }
                 
-                auto boulder = std::make_unique<Boulders::ResourceBoulder>(
-                    boulder_x, boulder_y, rng(), size, resource);
+                // One draw picks the shared pattern variant and the instance tint
+                unsigned int instance_seed = rng();
+                std::uint16_t pattern_id = getBoulderPatternId(size, resource, instance_seed % PATTERN_VARIANTS);
                 
-                if (canPlaceObjectFast(*boulder, world_data)) {
-                    addObject(std::move(boulder));
+                if (canPlaceObjectFast(pattern_id, boulder_x, boulder_y, world_data)) {
+                    addObject(boulder_x, boulder_y, pattern_id, static_cast<std::uint8_t>(instance_seed >> 24));
                     boulders_placed++;
                 }
             }
@@ -104,7 +172,8 @@ void VegetationObjectManager::generateOptimizedBoulders(WorldData& world_data, u
     }
 }
 
-void VegetationObjectManager::generateOptimizedTrees(WorldData& world_data, unsigned int seed) {
+void VegetationObjectManager::generateOptimizedTrees(WorldData& world_data, unsigned int seed,
+                                                     const VegetationGenerator& density) {
     std::mt19937 rng(seed);
     std::uniform_real_distribution<float> dist_0_1(0.0f, 1.0f);
     
@@ -115,14 +184,19 @@ void VegetationObjectManager::generateOptimizedTrees(WorldData& world_data, unsi
     
     // OPTIMIZED: Use cluster-based placement for natural forest appearance
     int clusters = total_tree_count / 15; // Each cluster has ~15 trees
+    int cluster_attempts = clusters * 4;  // Centres outside groves are rejected, so look further
+    int clusters_started = 0;
     int trees_placed = 0;
     
-    for (int cluster = 0; cluster < clusters && trees_placed < total_tree_count; ++cluster) {
-        // Find cluster center
+    for (int attempt = 0; attempt < cluster_attempts && clusters_started < clusters &&
+                          trees_placed < total_tree_count; ++attempt) {
+        // Find cluster center; forests only start where the tree density forms a grove
         int center_x = 50 + static_cast<int>(dist_0_1(rng) * (world_data.map_width - 100));
         int center_y = 50 + static_cast<int>(dist_0_1(rng) * (world_data.map_height - 100));
         
+        if (density.getTreeDensity(center_x, center_y) < GROVE_DENSITY_THRESHOLD) continue;
         if (!isValidTreeLocation(center_x, center_y, world_data)) continue;
+        clusters_started++;
         
         // Place trees in cluster
         int cluster_radius = 20 + static_cast<int>(dist_0_1(rng) * 20);
@@ -140,32 +214,20 @@ void VegetationObjectManager::generateOptimizedTrees(WorldData& world_data, unsi
             tree_x = std::max(20, std::min(tree_x, world_data.map_width - 20));
             tree_y = std::max(20, std::min(tree_y, world_data.map_height - 20));
             
+            // Thin the cluster by local density: fully stocked at forest density, sparse at its fringe
+            if (dist_0_1(rng) * FOREST_DENSITY_THRESHOLD >= density.getTreeDensity(tree_x, tree_y)) continue;
+            
             if (isValidTreeLocation(tree_x, tree_y, world_data)) {
-                // Check spacing from existing objects (simplified)
-                bool too_close = false;
-                for (const auto& existing : objects) {
-                    int dx = tree_x - existing->getOriginX();
-                    int dy = tree_y - existing->getOriginY();
-                    float dist = std::sqrt(dx * dx + dy * dy);
-                    if (dist < config.min_tree_spacing) {
-                        too_close = true;
-                        break;
-                    }
-                }
-                
-                if (!too_close) {
-                    // Create tree
+                // Check spacing from nearby objects only (placement grid)
+                if (!hasOriginWithin(tree_x, tree_y, config.min_tree_spacing)) {
+                    // Pick a tree variant
                     bool is_ancient = dist_0_1(rng) < config.ancient_tree_rarity;
+                    unsigned int instance_seed = rng();
+                    std::uint16_t first_pattern = is_ancient ? ancient_oak_first_pattern : young_tree_first_pattern;
+                    std::uint16_t pattern_id = static_cast<std::uint16_t>(first_pattern + instance_seed % PATTERN_VARIANTS);
                     
-                    std::unique_ptr<BaseVegetationObject> tree;
-                    if (is_ancient) {
-                        tree = std::make_unique<Trees::AncientOakTree>(tree_x, tree_y, rng());
-                    } else {
-                        tree = std::make_unique<Trees::YoungTree>(tree_x, tree_y, rng());
-                    }
-                    
-                    if (canPlaceObjectFast(*tree, world_data)) {
-                        addObject(std::move(tree));
+                    if (canPlaceObjectFast(pattern_id, tree_x, tree_y, world_data)) {
+                        addObject(tree_x, tree_y, pattern_id, static_cast<std::uint8_t>(instance_seed >> 24));
                         trees_placed++;
                     }
                 }
@@ -214,91 +276,235 @@ bool VegetationObjectManager::isValidTreeLocation(int x, int y, const WorldData&
     return height >= 0.05f && height <= 0.7f && slope <= 0.03f;
 }
 
-bool VegetationObjectManager::canPlaceObjectFast(const BaseVegetationObject& object, WorldData& world_data) const {
+bool VegetationObjectManager::canPlaceObjectFast(std::uint16_t pattern_id, int origin_x, int origin_y,
+                                                 WorldData& world_data) const {
     // OPTIMIZED: Faster placement check
-    if (!object.canPlaceAt(object.getOriginX(), object.getOriginY(), 
-                          world_data.heightmap_data, world_data.slope_map,
-                          world_data.map_width, world_data.map_height)) {
+    if (!prototypes[pattern_id]->canPlaceAt(origin_x, origin_y,
+                                            world_data.heightmap_data, world_data.slope_map,
+                                            world_data.map_width, world_data.map_height)) {
         return false;
     }
     
-    // Simple overlap check - just check if any existing object's center is too close
-    for (const auto& existing : objects) {
-        int dx = object.getOriginX() - existing->getOriginX();
-        int dy = object.getOriginY() - existing->getOriginY();
-        float distance = std::sqrt(dx * dx + dy * dy);
-        
-        // Simple distance check based on object sizes
-        float min_distance = (object.getWidth() + existing->getWidth()) / 2.0f + 2.0f;
-        if (distance < min_distance) {
-            return false;
+    // Simple overlap check - is any existing object's origin too close? The required distance
+    // depends on both widths, so search as far as the widest placed object could need
+    if (placement_grid.empty()) return true;
+    int object_width = pattern_atlas.getEntry(pattern_id).width;
+    int search_radius = static_cast<int>(std::ceil((object_width + max_placed_object_width) / 2.0f + 2.0f));
+    int min_cell_x = std::max(0, (origin_x - search_radius) / PLACEMENT_GRID_CELL_SIZE);
+    int max_cell_x = std::min(placement_grid_cols - 1, (origin_x + search_radius) / PLACEMENT_GRID_CELL_SIZE);
+    int min_cell_y = std::max(0, (origin_y - search_radius) / PLACEMENT_GRID_CELL_SIZE);
+    int max_cell_y = std::min(placement_grid_rows - 1, (origin_y + search_radius) / PLACEMENT_GRID_CELL_SIZE);
+    
+    for (int cell_y = min_cell_y; cell_y <= max_cell_y; ++cell_y) {
+        for (int cell_x = min_cell_x; cell_x <= max_cell_x; ++cell_x) {
+            for (uint32_t existing_index : placement_grid[static_cast<size_t>(cell_y) * placement_grid_cols + cell_x]) {
+                const ObjectInstance& existing = objects[existing_index];
+                double dx = origin_x - existing.origin_x;
+                double dy = origin_y - existing.origin_y;
+                
+                // Simple distance check based on object sizes (squared, no sqrt)
+                double min_distance = (object_width + pattern_atlas.getEntry(existing.pattern_id).width) / 2.0 + 2.0;
+                if (dx * dx + dy * dy < min_distance * min_distance) {
+                    return false;
+                }
+            }
         }
     }
     
     return true;
 }
 
-// [Keep all the existing helper methods unchanged]
-bool VegetationObjectManager::canPlaceObject(const BaseVegetationObject& object, WorldData& world_data) const {
-    if (!object.canPlaceAt(object.getOriginX(), object.getOriginY(), 
-                          world_data.heightmap_data, world_data.slope_map,
-                          world_data.map_width, world_data.map_height)) {
-        return false;
+void VegetationObjectManager::resetPlacementGrid(int map_width, int map_height) {
+    placement_grid_cols = std::max(1, (map_width + PLACEMENT_GRID_CELL_SIZE - 1) / PLACEMENT_GRID_CELL_SIZE);
+    placement_grid_rows = std::max(1, (map_height + PLACEMENT_GRID_CELL_SIZE - 1) / PLACEMENT_GRID_CELL_SIZE);
+    placement_grid.assign(static_cast<size_t>(placement_grid_cols) * placement_grid_rows, {});
+    max_placed_object_width = 0;
+    for (size_t i = 0; i < objects.size(); ++i) {
+        addToPlacementGrid(static_cast<uint32_t>(i));
     }
-    return !hasCollision(object);
 }
 
-bool VegetationObjectManager::hasCollision(const BaseVegetationObject& object) const {
-    for (const auto& existing : objects) {
-        if (object.overlaps(*existing)) {
-            return true;
+void VegetationObjectManager::addToPlacementGrid(uint32_t object_index) {
+    if (placement_grid.empty()) return;
+    const ObjectInstance& object = objects[object_index];
+    int cell_x = std::max(0, std::min(placement_grid_cols - 1, object.origin_x / PLACEMENT_GRID_CELL_SIZE));
+    int cell_y = std::max(0, std::min(placement_grid_rows - 1, object.origin_y / PLACEMENT_GRID_CELL_SIZE));
+    placement_grid[static_cast<size_t>(cell_y) * placement_grid_cols + cell_x].push_back(object_index);
+    max_placed_object_width = std::max(max_placed_object_width, static_cast<int>(pattern_atlas.getEntry(object.pattern_id).width));
+}
+
+bool VegetationObjectManager::hasOriginWithin(int world_x, int world_y, int min_spacing) const {
+    if (placement_grid.empty()) return false;
+    int min_cell_x = std::max(0, (world_x - min_spacing) / PLACEMENT_GRID_CELL_SIZE);
+    int max_cell_x = std::min(placement_grid_cols - 1, (world_x + min_spacing) / PLACEMENT_GRID_CELL_SIZE);
+    int min_cell_y = std::max(0, (world_y - min_spacing) / PLACEMENT_GRID_CELL_SIZE);
+    int max_cell_y = std::min(placement_grid_rows - 1, (world_y + min_spacing) / PLACEMENT_GRID_CELL_SIZE);
+    
+    for (int cell_y = min_cell_y; cell_y <= max_cell_y; ++cell_y) {
+        for (int cell_x = min_cell_x; cell_x <= max_cell_x; ++cell_x) {
+            for (uint32_t existing_index : placement_grid[static_cast<size_t>(cell_y) * placement_grid_cols + cell_x]) {
+                int dx = world_x - objects[existing_index].origin_x;
+                int dy = world_y - objects[existing_index].origin_y;
+                if (dx * dx + dy * dy < min_spacing * min_spacing) {
+                    return true;
+                }
+            }
         }
     }
     return false;
 }
 
-void VegetationObjectManager::addObject(std::unique_ptr<BaseVegetationObject> object) {
-    BaseVegetationObject* obj_ptr = object.get();
-    objects.push_back(std::move(object));
-    addToSpatialIndex(obj_ptr);
+void VegetationObjectManager::addObject(int origin_x, int origin_y, std::uint16_t pattern_id, std::uint8_t tint) {
+    ObjectInstance object;
+    object.origin_x = origin_x;
+    object.origin_y = origin_y;
+    object.pattern_id = pattern_id;
+    object.tint = tint;
+    objects.push_back(object);
+    
+    uint32_t object_index = static_cast<uint32_t>(objects.size() - 1);
+    addToSpatialIndex(object_index);
+    addToPlacementGrid(object_index);
+    if (!object_id_raster.empty()) {
+        stampObjectIdRaster(object, object_index + 1);
+    }
 }
 
 Core::ScreenCell VegetationObjectManager::getTileDisplay(int world_x, int world_y, 
-                                                        int entity_x, int entity_y) const {
-    auto objects_here = getObjectsAt(world_x, world_y);
-    
-    if (objects_here.empty()) {
-        return {' ', sf::Color::Black, sf::Color::Black};
+                                                        int entity_x, int entity_y,
+                                                        float animation_time, float wind_strength) const {
+    const ObjectInstance* object = getObjectAt(world_x, world_y);
+    
+    Core::ScreenCell cell(' ', sf::Color::Black, sf::Color::Black);
+    if (object) {
+        getObjectTileDisplay(*object, world_x - object->origin_x, world_y - object->origin_y,
+                             entity_x == world_x && entity_y == world_y, animation_time, wind_strength, cell);
+    }
+    return cell;
+}
+
+bool VegetationObjectManager::getObjectTileDisplay(const ObjectInstance& object, int relative_x, int relative_y,
+                                                   bool entity_here, float animation_time, float wind_strength,
+                                                   Core::ScreenCell& cell) const {
+    const VegetationPatternAtlas::PatternTile& tile = pattern_atlas.getTile(object.pattern_id, relative_x, relative_y);
+    cell = Core::ScreenCell(tile.character, tile.foreground, tile.background);
+    
+    // Read-time animation on a copy of the shared pattern tile (never written back)
+    const BaseVegetationObject& prototype = *prototypes[object.pattern_id];
+    if (prototype.isAnimated()) {
+        prototype.animateTile(cell, relative_x, relative_y, tile.isCanopy(), animation_time, wind_strength);
     }
     
-    BaseVegetationObject* object = objects_here[0];
-    
-    BaseVegetationObject::EntityContext context;
-    context.entity_underneath = (entity_x == world_x && entity_y == world_y);
-    context.entity_x = entity_x;
-    context.entity_y = entity_y;
-    
-    int rel_x = world_x - object->getOriginX();
-    int rel_y = world_y - object->getOriginY();
+    // Per-instance tint so objects sharing a pattern do not look identical
+    float brightness = 0.9f + object.tint * (0.2f / 255.0f);
+    auto tintColor = [brightness](sf::Color& color) {
+        color.r = static_cast<sf::Uint8>(std::min(255.0f, color.r * brightness));
+        color.g = static_cast<sf::Uint8>(std::min(255.0f, color.g * brightness));
+        color.b = static_cast<sf::Uint8>(std::min(255.0f, color.b * brightness));
+    };
+    tintColor(cell.fg_color);
+    tintColor(cell.bg_color);
+    
+    // If there's an entity underneath a canopy tile, show the "under canopy" version
+    if (tile.isCanopy() && entity_here) {
+        // Transform canopy view to underneath view (darker, trunk-like); background alpha is kept
+        cell.character = (cell.character == 'T' || cell.character == 'A') ? '|' : '.';
+        cell.fg_color = sf::Color(
+            static_cast<sf::Uint8>(cell.fg_color.r * 0.4f),
+            static_cast<sf::Uint8>(cell.fg_color.g * 0.4f), 
+            static_cast<sf::Uint8>(cell.fg_color.b * 0.4f)
+        );
+        cell.bg_color = sf::Color(
+            static_cast<sf::Uint8>(cell.bg_color.r * 0.6f),
+            static_cast<sf::Uint8>(cell.bg_color.g * 0.6f),
+            static_cast<sf::Uint8>(cell.bg_color.b * 0.6f),
+            cell.bg_color.a
+        );
+    }
     
-    auto tile_data = object->getTileAt(rel_x, rel_y, context);
+    return cell.character != ' ' || cell.bg_color.a != 0;
+}
+
+void VegetationObjectManager::collectObjectsInRect(int min_x, int min_y, int max_x, int max_y, int map_width,
+                                                   std::vector<VisibleObject>& out) const {
+    out.clear();
+    if (map_width <= 0 || objects.empty()) return;
+    // Objects never extend above the map
+    min_y = std::max(0, min_y);
+    if (min_y >= max_y) return;
+    
+    // Split the (possibly wrapped) X range into one query per map period
+    int first_period = (min_x >= 0) ? min_x / map_width : -((-min_x + map_width - 1) / map_width);
+    for (int period_start = first_period * map_width; period_start < max_x; period_start += map_width) {
+        int query_min_x = std::max(min_x, period_start) - period_start;
+        int query_max_x = std::min(max_x, period_start + map_width) - period_start;
+        if (query_min_x >= query_max_x) continue;
+        
+        int start_cell_x = query_min_x / SPATIAL_CELL_SIZE;
+        int end_cell_x = (query_max_x - 1) / SPATIAL_CELL_SIZE;
+        int start_cell_y = min_y / SPATIAL_CELL_SIZE;
+        int end_cell_y = (max_y - 1) / SPATIAL_CELL_SIZE;
+        
+        for (int cell_y = start_cell_y; cell_y <= end_cell_y; ++cell_y) {
+            for (int cell_x = start_cell_x; cell_x <= end_cell_x; ++cell_x) {
+                auto it = spatial_index.find(getSpatialKey(cell_x * SPATIAL_CELL_SIZE, cell_y * SPATIAL_CELL_SIZE));
+                if (it == spatial_index.end()) continue;
+                
+                for (uint32_t object_index : it->second.objects) {
+                    const ObjectInstance& object = objects[object_index];
+                    const VegetationPatternAtlas::PatternEntry& entry = pattern_atlas.getEntry(object.pattern_id);
+                    int object_max_x = object.origin_x + entry.width;
+                    int object_max_y = object.origin_y + entry.height;
+                    if (object_max_x <= query_min_x || object.origin_x >= query_max_x ||
+                        object_max_y <= min_y || object.origin_y >= max_y) {
+                        continue;
+                    }
+                    // An object spans several index cells: report it only from the cell holding
+                    // the top-left corner of its overlap with the query
+                    if (std::max(object.origin_x, query_min_x) / SPATIAL_CELL_SIZE != cell_x ||
+                        std::max(object.origin_y, min_y) / SPATIAL_CELL_SIZE != cell_y) {
+                        continue;
+                    }
+                    VisibleObject visible;
+                    visible.object_index = object_index;
+                    visible.wrap_offset_x = period_start;
+                    out.push_back(visible);
+                }
+            }
+        }
+    }
     
-    return {tile_data.character, tile_data.foreground, tile_data.background};
+    std::sort(out.begin(), out.end(), [](const VisibleObject& a, const VisibleObject& b) {
+        return a.object_index != b.object_index ? a.object_index < b.object_index
+                                                : a.wrap_offset_x < b.wrap_offset_x;
+    });
 }
 
 bool VegetationObjectManager::hasTileAt(int world_x, int world_y) const {
-    return !getObjectsAt(world_x, world_y).empty();
+    return getObjectAt(world_x, world_y) != nullptr;
+}
+
+const VegetationObjectManager::ObjectInstance* VegetationObjectManager::getObjectAt(int world_x, int world_y) const {
+    if (object_id_raster.empty()) {
+        // Raster not built yet (objects added outside generateObjects)
+        auto objects_here = getObjectsAt(world_x, world_y);
+        return objects_here.empty() ? nullptr : objects_here[0];
+    }
+    if (world_x < 0 || world_x >= raster_width || world_y < 0 || world_y >= raster_height) {
+        return nullptr;
+    }
+    uint32_t object_id = object_id_raster[static_cast<size_t>(world_y) * raster_width + world_x];
+    return object_id ? &objects[object_id - 1] : nullptr;
 }
 
 bool VegetationObjectManager::isPassable(int world_x, int world_y) const {
     auto objects_here = getObjectsAt(world_x, world_y);
     
-    for (auto* object : objects_here) {
-        int rel_x = world_x - object->getOriginX();
-        int rel_y = world_y - object->getOriginY();
-        auto tile_data = object->getTileAt(rel_x, rel_y);
+    for (const ObjectInstance* object : objects_here) {
+        const VegetationPatternAtlas::PatternTile& tile =
+            pattern_atlas.getTile(object->pattern_id, world_x - object->origin_x, world_y - object->origin_y);
         
-        if (tile_data.blocks_movement) {
+        if (tile.blocksMovement()) {
             return false;
         }
     }
@@ -306,16 +512,16 @@ bool VegetationObjectManager::isPassable(int world_x, int world_y) const {
     return true;
 }
 
-std::vector<BaseVegetationObject*> VegetationObjectManager::getObjectsAt(int world_x, int world_y) const {
-    std::vector<BaseVegetationObject*> result;
+std::vector<const VegetationObjectManager::ObjectInstance*> VegetationObjectManager::getObjectsAt(int world_x, int world_y) const {
+    std::vector<const ObjectInstance*> result;
     
     uint64_t key = getSpatialKey(world_x, world_y);
     auto it = spatial_index.find(key);
     
     if (it != spatial_index.end()) {
-        for (auto* object : it->second.objects) {
-            if (object->containsPoint(world_x, world_y)) {
-                result.push_back(object);
+        for (uint32_t object_index : it->second.objects) {
+            if (containsPoint(objects[object_index], world_x, world_y)) {
+                result.push_back(&objects[object_index]);
             }
         }
     }
@@ -323,44 +529,78 @@ std::vector<BaseVegetationObject*> VegetationObjectManager::getObjectsAt(int wor
     return result;
 }
 
+bool VegetationObjectManager::containsPoint(const ObjectInstance& object, int world_x, int world_y) const {
+    const VegetationPatternAtlas::PatternEntry& entry = pattern_atlas.getEntry(object.pattern_id);
+    return (world_x >= object.origin_x && world_x < object.origin_x + entry.width &&
+            world_y >= object.origin_y && world_y < object.origin_y + entry.height);
+}
+
+void VegetationObjectManager::rebuildObjectIdRaster(int map_width, int map_height) {
+    raster_width = map_width;
+    raster_height = map_height;
+    object_id_raster.assign(static_cast<size_t>(map_width) * map_height, 0);
+    // Objects are stamped in placement order and never overwrite, so the first-placed
+    // object wins where footprints overlap (as getObjectsAt()[0] did)
+    for (size_t i = 0; i < objects.size(); ++i) {
+        stampObjectIdRaster(objects[i], static_cast<uint32_t>(i + 1));
+    }
+}
+
+void VegetationObjectManager::stampObjectIdRaster(const ObjectInstance& object, uint32_t object_id) {
+    const VegetationPatternAtlas::PatternEntry& entry = pattern_atlas.getEntry(object.pattern_id);
+    int start_x = std::max(0, object.origin_x);
+    int start_y = std::max(0, object.origin_y);
+    int end_x = std::min(raster_width, object.origin_x + entry.width);
+    int end_y = std::min(raster_height, object.origin_y + entry.height);
+    for (int y = start_y; y < end_y; ++y) {
+        uint32_t* row = &object_id_raster[static_cast<size_t>(y) * raster_width];
+        for (int x = start_x; x < end_x; ++x) {
+            if (row[x] == 0) row[x] = object_id;
+        }
+    }
+}
+
 uint64_t VegetationObjectManager::getSpatialKey(int world_x, int world_y) const {
     int cell_x = world_x / SPATIAL_CELL_SIZE;
     int cell_y = world_y / SPATIAL_CELL_SIZE;
     return (static_cast<uint64_t>(cell_x) << 32) | static_cast<uint64_t>(cell_y);
 }
 
-void VegetationObjectManager::addToSpatialIndex(BaseVegetationObject* object) {
-    int start_cell_x = object->getOriginX() / SPATIAL_CELL_SIZE;
-    int start_cell_y = object->getOriginY() / SPATIAL_CELL_SIZE;
-    int end_cell_x = (object->getOriginX() + object->getWidth() - 1) / SPATIAL_CELL_SIZE;
-    int end_cell_y = (object->getOriginY() + object->getHeight() - 1) / SPATIAL_CELL_SIZE;
+void VegetationObjectManager::addToSpatialIndex(uint32_t object_index) {
+    const ObjectInstance& object = objects[object_index];
+    const VegetationPatternAtlas::PatternEntry& entry = pattern_atlas.getEntry(object.pattern_id);
+    int start_cell_x = object.origin_x / SPATIAL_CELL_SIZE;
+    int start_cell_y = object.origin_y / SPATIAL_CELL_SIZE;
+    int end_cell_x = (object.origin_x + entry.width - 1) / SPATIAL_CELL_SIZE;
+    int end_cell_y = (object.origin_y + entry.height - 1) / SPATIAL_CELL_SIZE;
     
     for (int cell_y = start_cell_y; cell_y <= end_cell_y; ++cell_y) {
         for (int cell_x = start_cell_x; cell_x <= end_cell_x; ++cell_x) {
             uint64_t key = (static_cast<uint64_t>(cell_x) << 32) | static_cast<uint64_t>(cell_y);
-            spatial_index[key].objects.push_back(object);
+            spatial_index[key].objects.push_back(object_index);
         }
     }
 }
 
 void VegetationObjectManager::rebuildSpatialIndex() {
     spatial_index.clear();
-    for (const auto& object : objects) {
-        addToSpatialIndex(object.get());
-    }
-}
-
-void VegetationObjectManager::updateAnimations(float time_delta) {
-    for (auto& object : objects) {
-        if (object->isAnimated()) {
-            object->updateAnimation(time_delta);
-        }
+    for (size_t i = 0; i < objects.size(); ++i) {
+        addToSpatialIndex(static_cast<uint32_t>(i));
     }
 }
 
 void VegetationObjectManager::clear() {
     objects.clear();
+    prototypes.clear();
+    pattern_atlas.clear();
     spatial_index.clear();
+    object_id_raster.clear();
+    raster_width = 0;
+    raster_height = 0;
+    placement_grid.clear();
+    placement_grid_cols = 0;
+    placement_grid_rows = 0;
+    max_placed_object_width = 0;
 }
 
 void VegetationObjectManager::printStats() const {
@@ -368,12 +608,15 @@ void VegetationObjectManager::printStats() const {
     
     std::map<std::string, int> type_counts;
     for (const auto& object : objects) {
-        type_counts[object->getObjectType()]++;
+        type_counts[prototypes[object.pattern_id]->getObjectType()]++;
     }
     
     for (const auto& pair : type_counts) {
         std::cout << "      " << pair.first << ": " << pair.second << std::endl;
     }
+    std::cout << "      Pattern atlas: " << pattern_atlas.getPatternCount() << " variants, "
+              << pattern_atlas.getMemoryBytes() / 1024 << " KB; instances: "
+              << objects.size() * sizeof(ObjectInstance) / 1024 << " KB" << std::endl;
 }
 
 } // namespace MultiTileObjects
@@ -1,96 +1,176 @@
 // File: EmergentKingdoms/src/World/Systems/Vegetation/MultiTileObjects/VegetationObjectManager.h
 #pragma once
 #include "BaseVegetationObject.h"
+#include "VegetationPatternAtlas.h"
+#include "Boulders/ResourceBoulder.h"
 #include "../../../WorldData.h"
 #include "../../../../Core/Renderer.h"
 #include <vector>
 #include <memory>
 #include <unordered_map>
+#include <cstdint>
 
 namespace World {
 namespace Systems {
 namespace Vegetation {
+
+class VegetationGenerator;
+
 namespace MultiTileObjects {
 
 /**
  * OPTIMIZED Vegetation Object Manager
  * Fast generation of large trees, boulders, and grass fields
  * Uses grid-based placement and simplified algorithms for speed
+ *
+ * Flyweight layout: a bounded set of pattern variants per object type and size is
+ * generated once into the VegetationPatternAtlas; placed objects are ObjectInstances
+ * holding only origin, pattern id and tint.
  */
 class VegetationObjectManager {
 public:
+    // One placed object; shape, colours and behaviour come from its pattern
+    struct ObjectInstance {
+        std::int32_t origin_x = 0;
+        std::int32_t origin_y = 0;
+        std::uint16_t pattern_id = 0;  // Atlas pattern, also indexes the prototypes
+        std::uint8_t tint = 128;       // Per-instance brightness, 128 = pattern colours
+    };
+
+    // An object found by a viewport query; origin_x + wrap_offset_x lies in the query's frame
+    struct VisibleObject {
+        std::uint32_t object_index = 0;
+        int wrap_offset_x = 0;
+    };
+
     VegetationObjectManager();
     ~VegetationObjectManager() = default;
 
-    // Object lifecycle
-    void generateObjects(WorldData& world_data, unsigned int base_seed);
-    void updateAnimations(float time_delta);
+    // Object lifecycle. Trees follow the tree density layer, boulders the rock and resource layers
+    void generateObjects(WorldData& world_data, unsigned int base_seed, const VegetationGenerator& density);
     void clear();
 
-    // Rendering
-    Core::ScreenCell getTileDisplay(int world_x, int world_y, 
-                                   int entity_x = -1, int entity_y = -1) const;
+    // Rendering. Animated objects are evaluated here for the requested tile only, from
+    // animation_time (seconds) and the local wind strength (1 = average wind); nothing is
+    // advanced per frame for off-screen objects
+    Core::ScreenCell getTileDisplay(int world_x, int world_y,
+                                   int entity_x = -1, int entity_y = -1,
+                                   float animation_time = 0.0f, float wind_strength = 1.0f) const;
     bool hasTileAt(int world_x, int world_y) const;
-    
+
+    // Viewport stamping: every object whose footprint meets [min_x, max_x) x [min_y, max_y),
+    // in placement order. X may run past either map edge and wraps on map_width
+    void collectObjectsInRect(int min_x, int min_y, int max_x, int max_y, int map_width,
+                              std::vector<VisibleObject>& out) const;
+    const ObjectInstance& getObject(std::uint32_t object_index) const { return objects[object_index]; }
+    int getObjectWidth(const ObjectInstance& object) const { return pattern_atlas.getEntry(object.pattern_id).width; }
+    int getObjectHeight(const ObjectInstance& object) const { return pattern_atlas.getEntry(object.pattern_id).height; }
+    // One tile of one object, animated and tinted; fully transparent tiles return false
+    bool getObjectTileDisplay(const ObjectInstance& object, int relative_x, int relative_y, bool entity_here,
+                              float animation_time, float wind_strength, Core::ScreenCell& cell) const;
+
     // Collision and interaction
     bool isPassable(int world_x, int world_y) const;
-    std::vector<BaseVegetationObject*> getObjectsAt(int world_x, int world_y) const;
-    
+    std::vector<const ObjectInstance*> getObjectsAt(int world_x, int world_y) const;
+    // First-placed object covering the tile (one raster read), or nullptr
+    const ObjectInstance* getObjectAt(int world_x, int world_y) const;
+
     // Object management
-    void addObject(std::unique_ptr<BaseVegetationObject> object);
-    
+    void addObject(int origin_x, int origin_y, std::uint16_t pattern_id, std::uint8_t tint = 128);
+
+    // The full set of pattern variants the atlas bakes, in pattern-id order and with patterns
+    // not yet generated: oaks, young trees, then boulders by [size][resource][variant].
+    // Shared with the pattern-generation benchmark so both time the same work
+    static std::vector<std::unique_ptr<BaseVegetationObject>> createPatternPrototypes(unsigned int seed);
+
     // Statistics and debugging
     size_t getObjectCount() const { return objects.size(); }
     void printStats() const;
 
 private:
     // Object storage
-    std::vector<std::unique_ptr<BaseVegetationObject>> objects;
-    
-    // Spatial indexing for fast lookups
+    std::vector<ObjectInstance> objects;
+
+    // Shared patterns: prototypes[id] generated atlas pattern id and supplies its behaviour
+    VegetationPatternAtlas pattern_atlas;
+    std::vector<std::unique_ptr<BaseVegetationObject>> prototypes;
+    std::uint16_t ancient_oak_first_pattern = 0;
+    std::uint16_t young_tree_first_pattern = 0;
+    std::uint16_t boulder_first_pattern = 0;   // [size][resource][variant]
+    static constexpr int PATTERN_VARIANTS = 8; // Variants per object type and size
+    static constexpr int BOULDER_SIZE_COUNT = 4;
+    static constexpr int BOULDER_RESOURCE_COUNT = 5;
+
+    // Spatial indexing for fast lookups (object indices)
     struct SpatialCell {
-        std::vector<BaseVegetationObject*> objects;
+        std::vector<uint32_t> objects;
     };
     std::unordered_map<uint64_t, SpatialCell> spatial_index;
     static constexpr int SPATIAL_CELL_SIZE = 32; // Tiles per spatial cell
-    
+
+    // Object-id raster: per tile, 1 + index into objects of the first-placed object whose
+    // footprint covers it (0 = none). Built after placement; turns point queries into one read
+    std::vector<uint32_t> object_id_raster;
+    int raster_width = 0;
+    int raster_height = 0;
+
+    // Placement grid: object indices bucketed by origin so spacing checks only visit nearby cells
+    std::vector<std::vector<uint32_t>> placement_grid;
+    int placement_grid_cols = 0;
+    int placement_grid_rows = 0;
+    int max_placed_object_width = 0; // Widest object placed so far, bounds the canPlaceObjectFast search
+    static constexpr int PLACEMENT_GRID_CELL_SIZE = 16; // Tiles per placement cell
+
     // OPTIMIZED Generation parameters
     struct GenerationConfig {
         // Tree generation - OPTIMIZED for performance and density
         float tree_density = 0.4f;         // High density for lush forests
         float ancient_tree_rarity = 0.3f;  // Good mix of ancient/young
         int min_tree_spacing = 8;          // Reasonable spacing for performance
-        
-        // Boulder generation - OPTIMIZED  
+
+        // Boulder generation - OPTIMIZED
         float boulder_density = 0.15f;     // More impressive formations
         float large_boulder_rarity = 0.35f; // Good mix of sizes
         int min_boulder_spacing = 15;      // Reasonable spacing
-        
+
         // Resource generation
         float resource_boulder_chance = 0.5f; // Good resource opportunities
     };
     GenerationConfig config;
-    
+
+    // Pattern atlas
+    void buildPatternAtlas(unsigned int seed);
+    std::uint16_t getBoulderPatternId(Boulders::ResourceBoulder::BoulderSize size,
+                                      Boulders::ResourceBoulder::ResourceType resource, int variant) const;
+
     // OPTIMIZED Generation methods - Fast algorithms
-    void generateOptimizedBoulders(WorldData& world_data, unsigned int seed);
-    void generateOptimizedTrees(WorldData& world_data, unsigned int seed);
-    
+    void generateOptimizedBoulders(WorldData& world_data, unsigned int seed, const VegetationGenerator& density);
+    void generateOptimizedTrees(WorldData& world_data, unsigned int seed, const VegetationGenerator& density);
+
     // OPTIMIZED Placement validation - Fast checks
-    bool canPlaceObjectFast(const BaseVegetationObject& object, WorldData& world_data) const;
+    bool canPlaceObjectFast(std::uint16_t pattern_id, int origin_x, int origin_y, WorldData& world_data) const;
     bool isValidBoulderLocation(int x, int y, const WorldData& world_data) const;
     bool isValidTreeLocation(int x, int y, const WorldData& world_data) const;
-    
-    // Original placement validation (for fallback)
-    bool canPlaceObject(const BaseVegetationObject& object, WorldData& world_data) const;
-    bool hasCollision(const BaseVegetationObject& object) const;
-    
+
+    // Instance geometry
+    bool containsPoint(const ObjectInstance& object, int world_x, int world_y) const;
+
+    // Object-id raster
+    void rebuildObjectIdRaster(int map_width, int map_height);
+    void stampObjectIdRaster(const ObjectInstance& object, uint32_t object_id);
+
+    // Placement grid
+    void resetPlacementGrid(int map_width, int map_height);
+    void addToPlacementGrid(uint32_t object_index);
+    bool hasOriginWithin(int world_x, int world_y, int min_spacing) const;
+
     // Spatial indexing
     uint64_t getSpatialKey(int world_x, int world_y) const;
-    void addToSpatialIndex(BaseVegetationObject* object);
+    void addToSpatialIndex(uint32_t object_index);
     void rebuildSpatialIndex();
 };
 
 } // namespace MultiTileObjects
 } // namespace Vegetation
 } // namespace Systems
-} // namespace World
\ No newline at end of file
+} // namespace World
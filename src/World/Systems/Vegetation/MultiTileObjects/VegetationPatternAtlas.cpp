@@ -0,0 +1,41 @@
+// File: EmergentKingdoms/src/World/Systems/Vegetation/MultiTileObjects/VegetationPatternAtlas.cpp
+#include "VegetationPatternAtlas.h"
+
+namespace World {
+namespace Systems {
+namespace Vegetation {
+namespace MultiTileObjects {
+
+std::uint16_t VegetationPatternAtlas::addPattern(const BaseVegetationObject& generated) {
+    PatternEntry entry;
+    entry.first_tile = static_cast<std::uint32_t>(tiles.size());
+    entry.width = static_cast<std::uint16_t>(generated.getWidth());
+    entry.height = static_cast<std::uint16_t>(generated.getHeight());
+
+    tiles.reserve(tiles.size() + static_cast<size_t>(entry.width) * entry.height);
+    for (int y = 0; y < entry.height; ++y) {
+        for (int x = 0; x < entry.width; ++x) {
+            BaseVegetationObject::ObjectTile source = generated.getTileAt(x, y);
+            PatternTile tile;
+            tile.character = source.character;
+            tile.flags = static_cast<std::uint8_t>((source.blocks_movement ? FLAG_BLOCKS_MOVEMENT : 0) |
+                                                   (source.is_canopy ? FLAG_CANOPY : 0));
+            tile.foreground = source.foreground;
+            tile.background = source.background;
+            tiles.push_back(tile);
+        }
+    }
+
+    entries.push_back(entry);
+    return static_cast<std::uint16_t>(entries.size() - 1);
+}
+
+void VegetationPatternAtlas::clear() {
+    tiles.clear();
+    entries.clear();
+}
+
+} // namespace MultiTileObjects
+} // namespace Vegetation
+} // namespace Systems
+} // namespace World
@@ -0,0 +1,63 @@
+// File: EmergentKingdoms/src/World/Systems/Vegetation/MultiTileObjects/VegetationPatternAtlas.h
+#pragma once
+#include "BaseVegetationObject.h"
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <cstdint>
+
+namespace World {
+namespace Systems {
+namespace Vegetation {
+namespace MultiTileObjects {
+
+/**
+ * Contiguous store of all multi-tile object patterns. Each pattern variant is
+ * generated once by its prototype object and copied here as a row-major block of
+ * compact tiles; every placed object of that variant reads the same block.
+ */
+class VegetationPatternAtlas {
+public:
+    // Compact form of BaseVegetationObject::ObjectTile (no redundant relative position)
+    struct PatternTile {
+        char character = ' ';
+        std::uint8_t flags = 0;
+        sf::Color foreground = sf::Color::White;
+        sf::Color background = sf::Color::Transparent;
+
+        bool blocksMovement() const { return (flags & FLAG_BLOCKS_MOVEMENT) != 0; }
+        bool isCanopy() const { return (flags & FLAG_CANOPY) != 0; }
+    };
+    static constexpr std::uint8_t FLAG_BLOCKS_MOVEMENT = 0x1;
+    static constexpr std::uint8_t FLAG_CANOPY = 0x2;
+
+    struct PatternEntry {
+        std::uint32_t first_tile = 0; // Offset into the tile array
+        std::uint16_t width = 0;
+        std::uint16_t height = 0;
+    };
+
+    // Copy a generated pattern into the atlas; returns its pattern id
+    std::uint16_t addPattern(const BaseVegetationObject& generated);
+    void clear();
+
+    const PatternEntry& getEntry(std::uint16_t pattern_id) const { return entries[pattern_id]; }
+    // relative_x/y must lie inside the pattern
+    const PatternTile& getTile(std::uint16_t pattern_id, int relative_x, int relative_y) const {
+        const PatternEntry& entry = entries[pattern_id];
+        return tiles[entry.first_tile + static_cast<std::uint32_t>(relative_y) * entry.width + relative_x];
+    }
+
+    size_t getPatternCount() const { return entries.size(); }
+    size_t getMemoryBytes() const {
+        return tiles.size() * sizeof(PatternTile) + entries.size() * sizeof(PatternEntry);
+    }
+
+private:
+    std::vector<PatternTile> tiles;
+    std::vector<PatternEntry> entries;
+};
+
+} // namespace MultiTileObjects
+} // namespace Vegetation
+} // namespace Systems
+} // namespace World
@@ -10,6 +10,7 @@ namespace Vegetation {
 const float FOREST_DENSITY_THRESHOLD = 0.7f;           // Dense forest formation
 const float WOODLAND_DENSITY_THRESHOLD = 0.5f;         // Scattered woodland
 const float GROVE_DENSITY_THRESHOLD = 0.3f;            // Small tree groups
+const float VEGETATION_DENSITY_RANGE = 2.0f;           // Quantised density layers cover 0 to this
 
 // ===== TREE PLACEMENT RULES =====
 const float TREE_MIN_HEIGHT = Core::TERRAIN_PLAINS_LOW;
@@ -32,6 +33,8 @@ const float HERB_PATCH_SIZE = 2.5f;                    // Clustered herb areas
 
 // ===== ROCK & BOULDER FORMATION =====
 const float BOULDER_CHANCE = 0.15f;                    // Scattered boulders
+const float BOULDER_MIN_ROCK_PLACEMENT = 0.35f;        // Rock placement below this stays boulder-free
+const float BOULDER_SIZE_FULL_ROCK_PLACEMENT = 1.0f;   // Rock placement at which the size bias saturates
 const float STANDING_STONE_RARITY = 0.05f;             // Ancient monoliths
 const float ROCK_OUTCROP_MIN_SLOPE = Core::SLOPE_THRESHOLD_GENTLE;
 
@@ -49,6 +52,7 @@ const float COPPER_NEAR_WATER_BONUS = 2.0f;           // Higher chance near wate
 // ===== WIND GRASS ANIMATION =====
 const float GRASS_WAVE_SPEED = 0.8f;                   // Gentle swaying speed
 const float GRASS_WAVE_INTENSITY = 0.6f;               // How pronounced the waves are
+const float GRASS_FLOW_PATCH_THRESHOLD = 0.5f;         // Regional wind exposure above this makes FLOWING_GRASS
 const int WIND_PATTERN_VARIATIONS = 8;                 // Different wind directions
 
 // ===== SHORELINE VEGETATION =====
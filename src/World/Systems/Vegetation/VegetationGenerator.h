@@ -3,6 +3,7 @@
 #include "../../WorldData.h"
 #include "../../../Core/FastNoiseLite.h"
 #include <vector>
+#include <cstdint>
 
 namespace World {
 namespace Systems {
@@ -11,21 +12,30 @@ namespace Vegetation {
 /**
  * Generates natural vegetation distribution patterns using noise-based algorithms
  * Creates realistic clustering and spacing for medieval fantasy landscapes
+ *
+ * All six fields (tree, bush, flower, rock, resource, wind) are evaluated in one
+ * fused sweep and stored as quantised uint8 layers: densities cover
+ * 0..VEGETATION_DENSITY_RANGE in 256 steps. The layers only live for the vegetation
+ * assignment and are released afterwards.
  */
 class VegetationGenerator {
 public:
     VegetationGenerator();
-    
+
     // Main generation method - creates all vegetation maps
     void generateVegetationMaps(WorldData& world_data, unsigned int base_seed);
-    
-    // Query methods for vegetation density at specific coordinates
-    float getTreeDensity(int x, int y, int map_width) const;
-    float getBushDensity(int x, int y, int map_width) const;
-    float getFlowerDensity(int x, int y, int map_width) const;
-    float getRockPlacement(int x, int y, int map_width) const;
-    float getResourcePlacement(int x, int y, int map_width) const;
-    int getWindDirection(int x, int y, int map_width) const;
+    void releaseVegetationMaps();
+
+    // Query methods for vegetation density at specific coordinates (0 outside the map)
+    float getTreeDensity(int x, int y) const { return decodeDensity(tree_density_layer, x, y); }
+    float getBushDensity(int x, int y) const { return decodeDensity(bush_density_layer, x, y); }
+    float getFlowerDensity(int x, int y) const { return decodeDensity(flower_density_layer, x, y); }
+    float getRockPlacement(int x, int y) const { return decodeDensity(rock_placement_layer, x, y); }
+    float getResourcePlacement(int x, int y) const { return decodeDensity(resource_placement_layer, x, y); }
+    float getWindExposure(int x, int y) const;                  // 0-1 regional wind noise
+    int getWindDirection(int x, int y) const;                   // 0 to WIND_PATTERN_VARIATIONS - 1
+
+    size_t getMemoryBytes() const { return tree_density_layer.size() * 6; }
 
 private:
     // Noise generators for different vegetation types
@@ -35,27 +45,28 @@ private:
     FastNoiseLite rock_noise;
     FastNoiseLite resource_noise;
     FastNoiseLite wind_noise;
-    
-    // Generated density maps
-    std::vector<float> tree_density_map;
-    std::vector<float> bush_density_map;
-    std::vector<float> flower_density_map;
-    std::vector<float> rock_placement_map;
-    std::vector<float> resource_placement_map;
-    std::vector<int> wind_direction_map;
-    
+
+    // Quantised density layers, row-major like the heightmap
+    std::vector<std::uint8_t> tree_density_layer;
+    std::vector<std::uint8_t> bush_density_layer;
+    std::vector<std::uint8_t> flower_density_layer;
+    std::vector<std::uint8_t> rock_placement_layer;
+    std::vector<std::uint8_t> resource_placement_layer;
+    std::vector<std::uint8_t> wind_layer;
+    int layer_width;
+    int layer_height;
+
     // Setup methods
     void setupNoiseGenerators(unsigned int base_seed);
-    
-    // Individual generation methods
-    void generateTreeDistribution(WorldData& world_data);
-    void generateBushDistribution(WorldData& world_data);
-    void generateFlowerDistribution(WorldData& world_data);
-    void generateRockDistribution(WorldData& world_data);
-    void generateResourceDistribution(WorldData& world_data);
-    void generateWindPatterns(WorldData& world_data);
+
+    // Fused sweep: every field for one tile, then quantise
+    void generateDensityLayers(WorldData& world_data);
+
+    static std::uint8_t quantizeDensity(float density);
+    bool isInside(int x, int y) const { return x >= 0 && x < layer_width && y >= 0 && y < layer_height; }
+    float decodeDensity(const std::vector<std::uint8_t>& layer, int x, int y) const;
 };
 
 } // namespace Vegetation
 } // namespace Systems
-} // namespace World
\ No newline at end of file
+} // namespace World
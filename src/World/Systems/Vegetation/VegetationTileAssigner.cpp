@@ -2,14 +2,16 @@
 #include "VegetationTileAssigner.h"
 #include "../../Map.h"
 #include "../../Tile.h"
+#include "../../TileWorkLists.h"
 #include "VegetationConfig.h"
 #include "MultiTileObjects/VegetationObjectManager.h"
 #include "MultiTileObjects/Trees/AncientOakTree.h"
 #include "MultiTileObjects/Trees/YoungTree.h"
 #include "MultiTileObjects/Boulders/ResourceBoulder.h"
+#include "../../../Core/HashNoise.h"
 #include <iostream>
-#include <random>
 #include <algorithm>
+#include <cmath>
 
 namespace World {
 namespace Systems {
@@ -22,106 +24,100 @@ VegetationTileAssigner::VegetationTileAssigner()
 VegetationTileAssigner::~VegetationTileAssigner() = default;
 
 void VegetationTileAssigner::process(WorldData& world_data, unsigned int base_world_seed, int step_seed_offset) {
+    std::vector<Tile>& tiles = world_data.map_context->getTilesRef();
+    const size_t tile_count = std::min(tiles.size(), static_cast<size_t>(world_data.map_width) * world_data.map_height);
+    std::vector<size_t> candidate_tiles = collectTileIndices(tile_count,
+        [&](size_t index) { return isSuitableForVegetation(tiles[index].base_type); });
+    assignTiles(world_data, candidate_tiles, base_world_seed, step_seed_offset);
+}
+
+void VegetationTileAssigner::assignTiles(WorldData& world_data, const std::vector<size_t>& candidate_tiles,
+                                         unsigned int base_world_seed, int step_seed_offset) {
     unsigned int vegetation_seed = base_world_seed + static_cast<unsigned int>(step_seed_offset);
     std::cout << "  Vegetation: Creating dense multi-tile medieval landscape..." << std::endl;
     
+    // Density layers for every vegetation kind, one fused sweep; placement reads them below
+    density_generator.generateVegetationMaps(world_data, vegetation_seed);
+    
     // Generate all multi-tile objects first
-    object_manager->generateObjects(world_data, vegetation_seed);
+    object_manager->generateObjects(world_data, vegetation_seed, density_generator);
     
     // ===== NEW: REGISTER OBJECT MANAGER WITH MAP FOR RENDERING =====
     if (world_data.map_context) {
         world_data.map_context->setVegetationObjectManager(object_manager.get());
     }
     
-    // Then apply single-tile vegetation to remaining areas (with reduced density since we have multi-tile objects)
-    applySingleTileVegetation(world_data, vegetation_seed);
-    
-    // Finally, apply enhanced grass animation to all grass areas
-    applyGrassAnimation(world_data, vegetation_seed);
+    // Then apply single-tile vegetation and grass animation to remaining areas
+    // (with reduced density since we have multi-tile objects)
+    applySingleTileVegetation(world_data, candidate_tiles, vegetation_seed);
+    density_generator.releaseVegetationMaps();
     
     std::cout << "  Vegetation: Created " << object_manager->getObjectCount() 
               << " multi-tile objects with flowing grass fields." << std::endl;
 }
 
-void VegetationTileAssigner::applySingleTileVegetation(WorldData& world_data, unsigned int seed) {
-    std::mt19937 rng(seed + 5000);
-    std::uniform_real_distribution<float> dist_0_1(0.0f, 1.0f);
-    
-    // Apply single-tile vegetation to areas not occupied by multi-tile objects
-    for (int y = 0; y < world_data.map_height; ++y) {
-        for (int x = 0; x < world_data.map_width; ++x) {
-            size_t index = static_cast<size_t>(y) * world_data.map_width + x;
-            
-            if (index >= world_data.map_context->getTilesRef().size()) continue;
-            
-            // Skip if this tile is occupied by a multi-tile object
-            if (object_manager->hasTileAt(x, y)) {
-                continue;
-            }
-            
-            BaseTileType current_type = world_data.map_context->getTilesRef()[index].base_type;
-            
-            // Only place single-tile vegetation on suitable base terrain
-            if (!isSuitableForVegetation(current_type)) {
-                continue;
-            }
-            
-            // Determine what single-tile vegetation to place
-            BaseTileType vegetation_type = determineSingleTileVegetationType(x, y, world_data, rng, dist_0_1);
-            
+void VegetationTileAssigner::applySingleTileVegetation(WorldData& world_data, const std::vector<size_t>& candidate_tiles,
+                                                       unsigned int seed) {
+    std::vector<Tile>& tiles = world_data.map_context->getTilesRef();
+    const int candidate_count = static_cast<int>(candidate_tiles.size());
+    
+    // Every roll is a hash of the tile position, so tiles are independent and the order is free
+    #pragma omp parallel for schedule(static)
+    for (int candidate = 0; candidate < candidate_count; ++candidate) {
+        size_t index = candidate_tiles[candidate];
+        if (index >= tiles.size()) continue;
+        
+        int x = static_cast<int>(index % world_data.map_width);
+        int y = static_cast<int>(index / world_data.map_width);
+        BaseTileType current_type = tiles[index].base_type;
+        
+        // Only place single-tile vegetation on suitable base terrain not occupied by a multi-tile object
+        if (isSuitableForVegetation(current_type) && !object_manager->hasTileAt(x, y)) {
+            BaseTileType vegetation_type = determineSingleTileVegetationType(x, y, world_data, seed + 5000);
             if (vegetation_type != current_type) {
                 replaceSingleTileVegetation(world_data, index, vegetation_type, x, y);
             }
         }
+        
+        // Grass that survived replacement may flow in the wind (objects do not block this)
+        markFlowingGrass(tiles[index], x, y, seed);
     }
 }
 
-void VegetationTileAssigner::applyGrassAnimation(WorldData& world_data, unsigned int seed) {
-    // Generate wind patterns for enhanced grass animation
-    
-    for (int y = 0; y < world_data.map_height; ++y) {
-        for (int x = 0; x < world_data.map_width; ++x) {
-            size_t index = static_cast<size_t>(y) * world_data.map_width + x;
-            
-            if (index >= world_data.map_context->getTilesRef().size()) continue;
-            
-            BaseTileType current_type = world_data.map_context->getTilesRef()[index].base_type;
-            
-            // Apply wind animation to grass tiles
-            if (current_type == BaseTileType::MEADOW || 
-                current_type == BaseTileType::PLAINS ||
-                current_type == BaseTileType::DRY_PLAINS) {
-                
-                // Create obvious wind patterns
-                float wind_noise = getWindNoise(x, y, seed);
-                float wind_strength = std::abs(std::sin(wind_noise * 6.28f)) * 0.8f + 0.2f;
-                
-                // Store wind animation data
-                world_data.map_context->getTilesRef()[index].animation_offset = wind_noise;
-                world_data.map_context->getTilesRef()[index].wave_strand_intensity = wind_strength;
-                
-                // Mark as animated grass
-                if (wind_strength > 0.5f) {
-                    world_data.map_context->getTilesRef()[index].base_type = BaseTileType::FLOWING_GRASS;
-                }
-            }
+void VegetationTileAssigner::markFlowingGrass(Tile& tile, int x, int y, unsigned int seed) const {
+    // Grass in wind-exposed patches becomes FLOWING_GRASS; the sway itself comes from the
+    // wind field at render time, so nothing time-dependent is stored here
+    if (tile.base_type == BaseTileType::MEADOW || 
+        tile.base_type == BaseTileType::PLAINS ||
+        tile.base_type == BaseTileType::DRY_PLAINS) {
+        
+        // Per-tile variation for the grass renderers' character choice
+        tile.animation_offset = Core::HashNoise::toUnitFloat(Core::HashNoise::hash2D(seed, x, y));
+        
+        if (density_generator.getWindExposure(x, y) > GRASS_FLOW_PATCH_THRESHOLD) {
+            tile.base_type = BaseTileType::FLOWING_GRASS;
         }
     }
 }
 
 BaseTileType VegetationTileAssigner::determineSingleTileVegetationType(int x, int y, WorldData& world_data, 
-                                                                       std::mt19937& rng, 
-                                                                       std::uniform_real_distribution<float>& dist) {
+                                                                       unsigned int seed) const {
     size_t index = static_cast<size_t>(y) * world_data.map_width + x;
     float height = world_data.heightmap_data[index];
     BaseTileType current_type = world_data.map_context->getTilesRef()[index].base_type;
     
+    // Independent per-tile rolls: one hash stream per vegetation kind
+    auto roll = [x, y, seed](unsigned int stream) {
+        return Core::HashNoise::toUnitFloat(Core::HashNoise::hash2D(seed + stream, x, y));
+    };
+    
     // FIXED: Very sparse single-tile placement since we have large multi-tile objects now
-    // Reduced all probabilities significantly
+    // Base chances apply at density 0.5; the density layers scale them so flowers, bushes
+    // and outcrops gather where their fields are high
     
-    // Very sparse small flowers and herbs only (reduced from 0.02f to 0.005f)
-    if (current_type == BaseTileType::MEADOW && dist(rng) < 0.005f) {
-        float flower_roll = dist(rng);
+    // Very sparse small flowers and herbs only
+    if (current_type == BaseTileType::MEADOW && roll(0) < 0.01f * density_generator.getFlowerDensity(x, y)) {
+        float flower_roll = roll(1);
         if (flower_roll < 0.3f) {
             return BaseTileType::WILDFLOWERS;
         } else if (flower_roll < 0.6f) {
@@ -129,13 +125,14 @@ BaseTileType VegetationTileAssigner::determineSingleTileVegetationType(int x, in
         }
     }
     
-    // Very sparse small bushes (reduced from 0.01f to 0.003f)
-    if ((current_type == BaseTileType::HILLS || current_type == BaseTileType::MOOR) && dist(rng) < 0.003f) {
-        return (dist(rng) < 0.5f) ? BaseTileType::BERRY_BUSH : BaseTileType::WILD_ROSES;
+    // Very sparse small bushes
+    if ((current_type == BaseTileType::HILLS || current_type == BaseTileType::MOOR) &&
+        roll(2) < 0.006f * density_generator.getBushDensity(x, y)) {
+        return (roll(3) < 0.5f) ? BaseTileType::BERRY_BUSH : BaseTileType::WILD_ROSES;
     }
     
-    // Very sparse small rock outcrops (reduced from 0.005f to 0.001f)
-    if (height > 0.3f && dist(rng) < 0.001f) {
+    // Very sparse small rock outcrops
+    if (height > 0.3f && roll(4) < 0.002f * density_generator.getRockPlacement(x, y)) {
         return BaseTileType::ROCK_OUTCROP;
     }
     
@@ -166,28 +163,6 @@ void VegetationTileAssigner::replaceSingleTileVegetation(WorldData& world_data,
     );
 }
 
-float VegetationTileAssigner::getWindNoise(int x, int y, unsigned int seed) const {
-    // Generate obvious wind patterns using multiple noise octaves
-    unsigned int noise_seed = seed + x * 73856093 + y * 19349663;
-    std::mt19937 rng(noise_seed);
-    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
-    
-    float noise = 0.0f;
-    float amplitude = 1.0f;
-    float frequency = 0.01f;
-    
-    // Multiple octaves for complex wind patterns
-    for (int octave = 0; octave < 3; ++octave) {
-        float octave_noise = dist(rng);
-        noise += octave_noise * amplitude;
-        amplitude *= 0.5f;
-        frequency *= 2.0f;
-        rng.seed(noise_seed + octave * 12345);
-    }
-    
-    return noise * 0.5f + 0.5f; // Normalize to 0-1
-}
-
 bool VegetationTileAssigner::isSuitableForVegetation(BaseTileType base_type) const {
     // Single-tile vegetation can grow on these terrain types
     return base_type == BaseTileType::MEADOW ||
@@ -1,8 +1,9 @@
 // File: EmergentKingdoms/src/World/Systems/Vegetation/VegetationTileAssigner.h
 #pragma once
 #include "../../GenerationSteps/IGenerationStep.h"
-#include <random>
+#include "VegetationGenerator.h"
 #include <memory>
+#include <vector>
 
 namespace World {
 namespace Systems {
@@ -16,7 +17,8 @@ namespace MultiTileObjects {
 /**
  * Enhanced Vegetation Tile Assigner with Multi-Tile Object Support
  * Creates large trees, boulders, and grass fields that span multiple tiles
- * Also handles single-tile vegetation and enhanced grass animation
+ * Also handles single-tile vegetation and flowing-grass patches (swayed by Wind::WindField)
+ * Placement is driven by the VegetationGenerator density layers, generated once per run
  */
 class VegetationTileAssigner : public Generation::IGenerationStep {
 public:
@@ -26,6 +28,10 @@ public:
     void process(WorldData& world_data, unsigned int base_world_seed, int step_seed_offset) override;
     std::string getName() const override { return "Multi-Tile Vegetation Assigner"; }
     
+    // Run with a precollected candidate list (scan order); tiles of other types are skipped
+    void assignTiles(WorldData& world_data, const std::vector<size_t>& candidate_tiles,
+                     unsigned int base_world_seed, int step_seed_offset);
+    
     // Multi-tile object interface
     Core::ScreenCell getMultiTileObjectDisplay(int world_x, int world_y, 
                                               int entity_x = -1, int entity_y = -1) const;
@@ -34,21 +40,19 @@ public:
 
 private:
     std::unique_ptr<MultiTileObjects::VegetationObjectManager> object_manager;
+    VegetationGenerator density_generator;
     
-    // Single-tile vegetation methods
-    void applySingleTileVegetation(WorldData& world_data, unsigned int seed);
-    void applyGrassAnimation(WorldData& world_data, unsigned int seed);
+    // Single-tile vegetation and flowing-grass patches, fused into one pass over the candidates
+    void applySingleTileVegetation(WorldData& world_data, const std::vector<size_t>& candidate_tiles,
+                                   unsigned int seed);
+    void markFlowingGrass(Tile& tile, int x, int y, unsigned int seed) const;
     
     BaseTileType determineSingleTileVegetationType(int x, int y, WorldData& world_data, 
-                                                  std::mt19937& rng, 
-                                                  std::uniform_real_distribution<float>& dist);
+                                                  unsigned int seed) const;
     
     void replaceSingleTileVegetation(WorldData& world_data, size_t index, 
                                     BaseTileType vegetation_type, int x, int y);
     
-    // Wind and animation
-    float getWindNoise(int x, int y, unsigned int seed) const;
-    
     // Helper methods
     bool isSuitableForVegetation(BaseTileType base_type) const;
 };
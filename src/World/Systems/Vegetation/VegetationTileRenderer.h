@@ -5,6 +5,7 @@
 #include "VegetationConfig.h"
 #include "../../../Core/BaseConfig.h"
 #include <cmath>
+#include <algorithm>
 
 namespace World {
 namespace Systems {
@@ -12,31 +13,62 @@ namespace Vegetation {
 
 class VegetationTileRenderer : public ITileRenderer {
 public:
+    static constexpr BaseTileType RENDERED_TYPES[] = {
+        BaseTileType::ANCIENT_OAK,
+        BaseTileType::NOBLE_PINE,
+        BaseTileType::SILVER_BIRCH,
+        BaseTileType::WEEPING_WILLOW,
+        BaseTileType::YOUNG_TREE,
+        BaseTileType::TREE_GROVE,
+        BaseTileType::DENSE_FOREST,
+        BaseTileType::DENSE_THICKET,
+        BaseTileType::BERRY_BUSH,
+        BaseTileType::WILD_ROSES,
+        BaseTileType::WILDFLOWER_MEADOW,
+        BaseTileType::WILDFLOWERS,
+        BaseTileType::ROYAL_LILY,
+        BaseTileType::HERB_PATCH,
+        BaseTileType::MOSSY_BOULDER,
+        BaseTileType::STANDING_STONE,
+        BaseTileType::ROCK_OUTCROP,
+        BaseTileType::GOLD_VEIN,
+        BaseTileType::SILVER_LODE,
+        BaseTileType::IRON_ORE,
+        BaseTileType::COPPER_DEPOSIT,
+        BaseTileType::FLOWING_GRASS
+    };
+
     bool canRender(BaseTileType tile_type) const override {
-        return tile_type == BaseTileType::ANCIENT_OAK ||
-               tile_type == BaseTileType::NOBLE_PINE ||
-               tile_type == BaseTileType::SILVER_BIRCH ||
-               tile_type == BaseTileType::WEEPING_WILLOW ||
-               tile_type == BaseTileType::YOUNG_TREE ||
-               tile_type == BaseTileType::TREE_GROVE ||
-               tile_type == BaseTileType::DENSE_FOREST ||
-               tile_type == BaseTileType::DENSE_THICKET ||
-               tile_type == BaseTileType::BERRY_BUSH ||
-               tile_type == BaseTileType::WILD_ROSES ||
-               tile_type == BaseTileType::WILDFLOWER_MEADOW ||
-               tile_type == BaseTileType::WILDFLOWERS ||
-               tile_type == BaseTileType::ROYAL_LILY ||
-               tile_type == BaseTileType::HERB_PATCH ||
-               tile_type == BaseTileType::MOSSY_BOULDER ||
-               tile_type == BaseTileType::STANDING_STONE ||
-               tile_type == BaseTileType::ROCK_OUTCROP ||
+        return containsTileType(RENDERED_TYPES, tile_type);
+    }
+
+    // Types whose output depends on global_water_animation_progress
+    static constexpr bool isAnimatedType(BaseTileType tile_type) {
+        return tile_type == BaseTileType::WILDFLOWER_MEADOW ||
+               tile_type == BaseTileType::FLOWING_GRASS ||
                tile_type == BaseTileType::GOLD_VEIN ||
-               tile_type == BaseTileType::SILVER_LODE ||
-               tile_type == BaseTileType::IRON_ORE ||
-               tile_type == BaseTileType::COPPER_DEPOSIT ||
+               tile_type == BaseTileType::SILVER_LODE;
+    }
+
+    // Grass types swayed by the wind field; draw them with renderWindDriven at render time
+    static constexpr bool isWindDrivenType(BaseTileType tile_type) {
+        return tile_type == BaseTileType::WILDFLOWER_MEADOW ||
                tile_type == BaseTileType::FLOWING_GRASS;
     }
 
+    // Wind-driven grass with the local wind. tile_anim_offset is the tile's static variation and
+    // picks flowers, colours and glyphs; the gust (0-1) only shifts the sway phase, so blades
+    // swing as the gust passes instead of re-rolling their look every frame
+    Core::ScreenCell renderWindDriven(BaseTileType base_type, float height_val, float slope_val,
+                                      SlopeAspect aspect_val, float tile_anim_offset,
+                                      float animation_progress, float gust_phase, float wind_strength) const {
+        unsigned int tile_hash = computeTileHash(height_val, slope_val, aspect_val, tile_anim_offset);
+        if (base_type == BaseTileType::WILDFLOWER_MEADOW) {
+            return renderWildflowerMeadow(tile_hash, animation_progress, gust_phase, wind_strength, height_val);
+        }
+        return renderFlowingGrass(tile_hash, animation_progress, gust_phase, wind_strength, height_val);
+    }
+
     Core::ScreenCell render(
         BaseTileType base_type, 
         float height_val, 
@@ -45,7 +77,7 @@ public:
         int dist_to_land, 
         float global_water_animation_progress, 
         float tile_anim_offset, 
-        float /* tile_wave_strand_intensity */,
+        float tile_wave_strand_intensity,
         bool is_marsh_water_patch_flag, 
         int tile_dist_to_water
     ) const override {
@@ -54,8 +86,7 @@ public:
         (void)is_marsh_water_patch_flag;
         (void)tile_dist_to_water;
 
-        unsigned int tile_hash = static_cast<unsigned int>(height_val * 1000 + slope_val * 100 + 
-                                                          static_cast<int>(aspect_val) + tile_anim_offset * 100);
+        unsigned int tile_hash = computeTileHash(height_val, slope_val, aspect_val, tile_anim_offset);
 
         switch (base_type) {
             // ===== TREES =====
@@ -84,7 +115,8 @@ public:
                 
             // ===== FLOWERS & HERBS =====
             case BaseTileType::WILDFLOWER_MEADOW:
-                return renderWildflowerMeadow(tile_hash, global_water_animation_progress, tile_anim_offset, height_val);
+                return renderWildflowerMeadow(tile_hash, global_water_animation_progress, tile_anim_offset,
+                                              tile_wave_strand_intensity, height_val);
             case BaseTileType::WILDFLOWERS:
                 return renderWildflowers(tile_hash, height_val);
             case BaseTileType::ROYAL_LILY:
@@ -112,7 +144,8 @@ public:
                 
             // ===== FLOWING GRASS =====
             case BaseTileType::FLOWING_GRASS:
-                return renderFlowingGrass(tile_hash, global_water_animation_progress, tile_anim_offset, height_val);
+                return renderFlowingGrass(tile_hash, global_water_animation_progress, tile_anim_offset,
+                                          tile_wave_strand_intensity, height_val);
                 
             default:
                 return {'?', Core::Colors::RED, Core::Colors::BLACK};
@@ -269,9 +302,9 @@ private:
     
     // ===== FLOWER RENDERERS =====
     Core::ScreenCell renderWildflowerMeadow(unsigned int tile_hash, float animation_progress, 
-                                           float wind_offset, float height_val) const {
+                                           float wind_offset, float wind_strength, float height_val) const {
         // Flowing grass with wildflowers
-        char ch = getWindGrassCharacter(tile_hash, animation_progress, wind_offset);
+        char ch = getWindGrassCharacter(tile_hash, animation_progress, wind_offset, wind_strength);
         sf::Color bg = getTerrainBackground(height_val); // FIXED: Always use terrain background
         sf::Color fg = Colors::MEADOW_GRASS_WAVE;
         
@@ -413,23 +446,31 @@ private:
     
     // ===== FLOWING GRASS RENDERER =====
     Core::ScreenCell renderFlowingGrass(unsigned int tile_hash, float animation_progress, 
-                                       float wind_offset, float height_val) const {
-        char ch = getWindGrassCharacter(tile_hash, animation_progress, wind_offset);
+                                       float wind_offset, float wind_strength, float height_val) const {
+        char ch = getWindGrassCharacter(tile_hash, animation_progress, wind_offset, wind_strength);
         sf::Color bg = getTerrainBackground(height_val); // FIXED: Always use terrain background
         sf::Color fg = Colors::MEADOW_GRASS_WAVE;
         
-        // Wind animation affects color intensity
-        float wind_intensity = std::sin((animation_progress + wind_offset) * 3.14159f * 2.0f) * 0.3f + 0.7f;
+        // Wind animation affects color intensity (stronger wind, deeper swing)
+        float swing = std::min(1.0f, 0.3f * wind_strength);
+        float wind_intensity = std::sin((animation_progress + wind_offset) * 3.14159f * 2.0f) * swing + 0.7f;
         fg = Tile::interpolateColor(bg, Colors::MEADOW_GRASS_WIND, wind_intensity);
         
         return {ch, fg, bg};
     }
     
     // ===== HELPER METHODS =====
-    char getWindGrassCharacter(unsigned int tile_hash, float animation_progress, float wind_offset) const {
-        // Create flowing wind pattern
+    static unsigned int computeTileHash(float height_val, float slope_val, SlopeAspect aspect_val,
+                                        float tile_anim_offset) {
+        return static_cast<unsigned int>(height_val * 1000 + slope_val * 100 +
+                                         static_cast<int>(aspect_val) + tile_anim_offset * 100);
+    }
+
+    char getWindGrassCharacter(unsigned int tile_hash, float animation_progress, float wind_offset,
+                               float gust_strength) const {
+        // Create flowing wind pattern; a coherent wind_offset makes neighbouring blades swing together
         float wind_phase = std::sin((animation_progress * GRASS_WAVE_SPEED + wind_offset) * 3.14159f * 2.0f);
-        float wind_strength = std::abs(wind_phase) * GRASS_WAVE_INTENSITY;
+        float wind_strength = std::abs(wind_phase) * GRASS_WAVE_INTENSITY * gust_strength;
         
         // Determine grass character based on wind strength and direction
         if (wind_strength < 0.2f) {
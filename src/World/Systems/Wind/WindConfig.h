@@ -0,0 +1,24 @@
+// File: EmergentKingdoms/src/World/Systems/Wind/WindConfig.h
+#pragma once
+#include "../../../Core/BaseConfig.h"
+
+namespace World {
+namespace Systems {
+namespace Wind {
+
+// ===== WIND FIELD GRID =====
+const int WIND_FIELD_CELL_SIZE = 32;                   // Tiles per wind grid cell (sampled bilinearly)
+
+// ===== PREVAILING WIND =====
+const float WIND_BASE_SPEED = 6.0f;                    // Average wind speed, tiles per second
+const float WIND_MEANDER_AMPLITUDE = 0.6f;             // Radians the prevailing direction swings
+const float WIND_MEANDER_RATE = 0.02f;                 // Radians per second of the swing cycle
+const float WIND_DIRECTION_VARIATION = 0.5f;           // Radians of fixed local deviation (valleys, ridges)
+
+// ===== GUSTS =====
+const float WIND_GUST_SCALE = 96.0f;                   // Tiles across one gust
+const float WIND_GUST_TRAVEL_SPEED = 12.0f;            // Tiles per second gust fronts move downwind
+
+} // namespace Wind
+} // namespace Systems
+} // namespace World
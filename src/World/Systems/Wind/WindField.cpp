@@ -0,0 +1,135 @@
+// File: EmergentKingdoms/src/World/Systems/Wind/WindField.cpp
+#include "WindField.h"
+#include "../../../Core/HashNoise.h"
+#include <algorithm>
+#include <omp.h>
+
+namespace World {
+namespace Systems {
+namespace Wind {
+
+WindField::WindField()
+    : map_width(0), map_height(0), cols(0), rows(0),
+      cell_width(1.0f), cell_height(1.0f), field_seed(0), prevailing_angle(0.0f) {
+}
+
+void WindField::initialize(int width, int height, unsigned int seed) {
+    map_width = width;
+    map_height = height;
+    field_seed = seed;
+    cols = std::max(1, (width + WIND_FIELD_CELL_SIZE - 1) / WIND_FIELD_CELL_SIZE);
+    rows = std::max(2, (height + WIND_FIELD_CELL_SIZE - 1) / WIND_FIELD_CELL_SIZE + 1);
+    cell_width = static_cast<float>(width) / cols;
+    cell_height = static_cast<float>(std::max(1, height - 1)) / (rows - 1);
+
+    prevailing_angle = Core::HashNoise::toUnitFloat(Core::HashNoise::hash1D(seed, 0)) * 2.0f * 3.14159265f;
+
+    // Terrain-like local deviation does not change over time, so it is rolled once
+    direction_offsets.resize(static_cast<size_t>(cols) * rows);
+    for (int row = 0; row < rows; ++row) {
+        for (int col = 0; col < cols; ++col) {
+            float noise = wrappedNoise(seed + 1, col * cell_width, row * cell_height, WIND_GUST_SCALE * 2.0f);
+            direction_offsets[static_cast<size_t>(row) * cols + col] = (noise * 2.0f - 1.0f) * WIND_DIRECTION_VARIATION;
+        }
+    }
+
+    nodes.assign(static_cast<size_t>(cols) * rows, WindNode());
+    update(0.0f);
+}
+
+float WindField::wrappedNoise(unsigned int seed, float x, float y, float scale) const {
+    // Blend the noise with a copy shifted by one map width: equal at x = 0 and x = map_width
+    float blend = x / static_cast<float>(map_width);
+    float here = Core::HashNoise::valueNoise2D(seed, x / scale, y / scale);
+    float wrapped = Core::HashNoise::valueNoise2D(seed, (x - map_width) / scale, y / scale);
+    return here + (wrapped - here) * blend;
+}
+
+WindField::FrameWind WindField::computeFrameWind(float time_seconds) const {
+    // The prevailing direction swings slowly; gusts drift downwind along the base direction
+    FrameWind frame;
+    frame.angle = prevailing_angle + std::sin(time_seconds * WIND_MEANDER_RATE) * WIND_MEANDER_AMPLITUDE;
+    frame.drift_x = std::cos(prevailing_angle) * WIND_GUST_TRAVEL_SPEED * time_seconds;
+    frame.drift_y = std::sin(prevailing_angle) * WIND_GUST_TRAVEL_SPEED * time_seconds;
+    return frame;
+}
+
+void WindField::updateNode(int row, int col, const FrameWind& frame) {
+    size_t index = static_cast<size_t>(row) * cols + col;
+    float width = static_cast<float>(map_width);
+    float advected_x = std::fmod(col * cell_width - frame.drift_x, width);
+    if (advected_x < 0.0f) advected_x += width;
+
+    WindNode& node = nodes[index];
+    node.gust = wrappedNoise(field_seed, advected_x, row * cell_height - frame.drift_y, WIND_GUST_SCALE);
+    float speed = WIND_BASE_SPEED * (0.5f + node.gust);
+    float node_angle = frame.angle + direction_offsets[index];
+    node.velocity_x = std::cos(node_angle) * speed;
+    node.velocity_y = std::sin(node_angle) * speed;
+}
+
+void WindField::update(float time_seconds) {
+    if (nodes.empty()) return;
+    FrameWind frame = computeFrameWind(time_seconds);
+
+    #pragma omp parallel for schedule(static)
+    for (int row = 0; row < rows; ++row) {
+        for (int col = 0; col < cols; ++col) {
+            updateNode(row, col, frame);
+        }
+    }
+}
+
+void WindField::updateRegion(float time_seconds, int min_x, int min_y, int max_x, int max_y) {
+    if (nodes.empty()) return;
+    FrameWind frame = computeFrameWind(time_seconds);
+
+    // sample() reads the node at or before a point and the next one; widen by one node each way
+    int first_col = static_cast<int>(std::floor(min_x / cell_width)) - 1;
+    int last_col = static_cast<int>(std::floor((max_x - 1) / cell_width)) + 2;
+    int first_row = std::max(0, static_cast<int>(std::floor(min_y / cell_height)) - 1);
+    int last_row = std::min(rows - 1, static_cast<int>(std::floor((max_y - 1) / cell_height)) + 2);
+    if (last_col - first_col + 1 >= cols) {
+        first_col = 0;
+        last_col = cols - 1;
+    }
+
+    #pragma omp parallel for schedule(static)
+    for (int row = first_row; row <= last_row; ++row) {
+        for (int unwrapped_col = first_col; unwrapped_col <= last_col; ++unwrapped_col) {
+            updateNode(row, ((unwrapped_col % cols) + cols) % cols, frame);
+        }
+    }
+}
+
+WindSample WindField::sample(int world_x, int world_y) const {
+    WindSample result;
+    if (nodes.empty()) return result;
+
+    float grid_x = static_cast<float>(((world_x % map_width) + map_width) % map_width) / cell_width;
+    float grid_y = std::max(0.0f, std::min(static_cast<float>(rows - 1), world_y / cell_height));
+    int col0 = std::min(cols - 1, static_cast<int>(grid_x));
+    int row0 = std::min(rows - 2, static_cast<int>(grid_y));
+    int col1 = (col0 + 1) % cols;  // Wraps on X
+    float tx = grid_x - col0;
+    float ty = grid_y - row0;
+
+    const WindNode& n00 = nodes[static_cast<size_t>(row0) * cols + col0];
+    const WindNode& n10 = nodes[static_cast<size_t>(row0) * cols + col1];
+    const WindNode& n01 = nodes[static_cast<size_t>(row0 + 1) * cols + col0];
+    const WindNode& n11 = nodes[static_cast<size_t>(row0 + 1) * cols + col1];
+
+    auto bilinear = [tx, ty](float v00, float v10, float v01, float v11) {
+        float top = v00 + (v10 - v00) * tx;
+        float bottom = v01 + (v11 - v01) * tx;
+        return top + (bottom - top) * ty;
+    };
+    result.velocity_x = bilinear(n00.velocity_x, n10.velocity_x, n01.velocity_x, n11.velocity_x);
+    result.velocity_y = bilinear(n00.velocity_y, n10.velocity_y, n01.velocity_y, n11.velocity_y);
+    result.gust = bilinear(n00.gust, n10.gust, n01.gust, n11.gust);
+    return result;
+}
+
+} // namespace Wind
+} // namespace Systems
+} // namespace World
@@ -0,0 +1,83 @@
+// File: EmergentKingdoms/src/World/Systems/Wind/WindField.h
+#pragma once
+#include "WindConfig.h"
+#include <vector>
+#include <cmath>
+
+namespace World {
+namespace Systems {
+namespace Wind {
+
+// Wind at one map position
+struct WindSample {
+    float velocity_x = 0.0f;   // Tiles per second
+    float velocity_y = 0.0f;
+    float gust = 0.0f;         // 0-1 gust intensity; travels downwind over time
+
+    // Speed relative to the average wind (about 0.5 in a lull, 1.5 in a gust)
+    float strength() const {
+        return std::sqrt(velocity_x * velocity_x + velocity_y * velocity_y) / WIND_BASE_SPEED;
+    }
+};
+
+/**
+ * Coherent, time-evolving wind over the whole map. A coarse grid (one node per
+ * WIND_FIELD_CELL_SIZE tiles) holds the wind vector and gust intensity;
+ * updateRegion() re-evaluates the nodes under the viewport for a new time once per
+ * frame and sample() interpolates them bilinearly, so per-tile cost is four node reads.
+ *
+ * Gusts are value noise advected downwind, so fronts sweep across meadows and
+ * forests. The field wraps on X like the map.
+ */
+class WindField {
+public:
+    WindField();
+
+    void initialize(int map_width, int map_height, unsigned int seed);
+    bool isInitialized() const { return !nodes.empty(); }
+
+    // Re-evaluate every node for time_seconds (a pure function of time and seed)
+    void update(float time_seconds);
+    // Re-evaluate only the nodes sample() reads for [min_x, max_x) x [min_y, max_y), plus one
+    // node of margin, so points up to one node spacing (at most WIND_FIELD_CELL_SIZE tiles)
+    // outside the rect are also current.
+    // X may run past either map edge
+    void updateRegion(float time_seconds, int min_x, int min_y, int max_x, int max_y);
+
+    // Call after update()/updateRegion() covering the point; x wraps, y is clamped
+    WindSample sample(int world_x, int world_y) const;
+
+private:
+    struct WindNode {
+        float velocity_x = 0.0f;
+        float velocity_y = 0.0f;
+        float gust = 0.0f;
+    };
+
+    int map_width;
+    int map_height;
+    int cols;                  // Nodes across; they span exactly map_width so X wraps seamlessly
+    int rows;                  // Nodes down, including one on the bottom edge
+    float cell_width;
+    float cell_height;
+    unsigned int field_seed;
+    float prevailing_angle;    // Radians, rolled from the seed
+    std::vector<float> direction_offsets;  // Fixed local deviation per node
+    std::vector<WindNode> nodes;
+
+    // Time-dependent state shared by every node evaluated for one time
+    struct FrameWind {
+        float angle;
+        float drift_x;
+        float drift_y;
+    };
+    FrameWind computeFrameWind(float time_seconds) const;
+    void updateNode(int row, int col, const FrameWind& frame);
+
+    // Value noise that repeats every map_width tiles on X
+    float wrappedNoise(unsigned int seed, float x, float y, float scale) const;
+};
+
+} // namespace Wind
+} // namespace Systems
+} // namespace World
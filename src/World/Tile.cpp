@@ -1,51 +1,42 @@
 // File: EmergentKingdoms/src/World/Tile.cpp
 #include "Tile.h"
-#include "Systems/Rivers/RiverTileRenderer.h"
-#include "Systems/Lakes/LakeTileRenderer.h"
-#include "Systems/Mountains/MountainTileRenderer.h"
-#include "Systems/Land/LandTileRenderer.h"
-#include "Systems/Vegetation/VegetationTileRenderer.h"
+#include "Systems/TileRendererDispatch.h"
 #include "../Core/BaseConfig.h"
 #include <vector>
 #include <memory>
 
 namespace World {
 
-// Static registry of tile renderers
-std::vector<std::unique_ptr<Systems::ITileRenderer>> createTileRenderers() {
-    std::vector<std::unique_ptr<Systems::ITileRenderer>> renderers;
-    
-    // Order matters - first match wins
-    renderers.push_back(std::make_unique<Systems::Rivers::RiverTileRenderer>());
-    renderers.push_back(std::make_unique<Systems::Lakes::LakeTileRenderer>());
-    renderers.push_back(std::make_unique<Systems::Mountains::MountainTileRenderer>());
-    renderers.push_back(std::make_unique<Systems::Vegetation::VegetationTileRenderer>()); // NEW!
-    renderers.push_back(std::make_unique<Systems::Land::LandTileRenderer>());
-    
-    return renderers;
-}
-
 Core::ScreenCell Tile::determineDisplay(BaseTileType base_type, float height_val, float slope_val, 
                                         SlopeAspect aspect_val, int dist_to_land, 
                                         float global_water_animation_progress, 
                                         float tile_anim_offset, float tile_wave_strand_intensity,
                                         bool is_marsh_water_patch_flag, int tile_dist_to_water) {
     
-    static auto renderers = createTileRenderers();
-    
-    // Find the appropriate renderer for this tile type
-    for (const auto& renderer : renderers) {
-        if (renderer->canRender(base_type)) {
-            return renderer->render(base_type, height_val, slope_val, aspect_val, dist_to_land,
-                                  global_water_animation_progress, tile_anim_offset, tile_wave_strand_intensity,
-                                  is_marsh_water_patch_flag, tile_dist_to_water);
-        }
+    // Direct lookup in the compile-time dispatch table (every type has exactly one renderer)
+    size_t type_index = static_cast<size_t>(base_type);
+    if (type_index < BASE_TILE_TYPE_COUNT) {
+        return Systems::TILE_RENDER_TABLE[type_index](base_type, height_val, slope_val, aspect_val, dist_to_land,
+                                                      global_water_animation_progress, tile_anim_offset,
+                                                      tile_wave_strand_intensity, is_marsh_water_patch_flag,
+                                                      tile_dist_to_water);
     }
     
     // Fallback if no renderer found
     return {' ', Core::Colors::WHITE, Core::Colors::BLACK};
 }
 
+bool Tile::isAnimated(BaseTileType base_type) {
+    size_t type_index = static_cast<size_t>(base_type);
+    return type_index < BASE_TILE_TYPE_COUNT && Systems::TILE_ANIMATED_TABLE[type_index];
+}
+
+void Tile::updateDisplay(float global_water_animation_progress) {
+    display_cell = determineDisplay(base_type, height_val, slope_val, aspect_val, distance_to_land,
+                                    global_water_animation_progress, animation_offset, wave_strand_intensity,
+                                    is_marsh_water_patch, distance_to_water);
+}
+
 Tile Tile::create(BaseTileType base_type, float height, float slope, SlopeAspect aspect, 
                   int distance_to_land_val, int distance_to_water_val, 
                   float anim_offset_val, float strand_intensity_val, 
@@ -61,9 +52,7 @@ Tile Tile::create(BaseTileType base_type, float height, float slope, SlopeAspect
     t.wave_strand_intensity = strand_intensity_val;
     t.is_marsh_water_patch = is_marsh_water_patch_flag; 
 
-    t.display_cell = determineDisplay(base_type, height, slope, aspect, t.distance_to_land, 0.0f, 
-                                     t.animation_offset, t.wave_strand_intensity, t.is_marsh_water_patch, t.distance_to_water);
-
+    // display_cell is filled in by Map's finalisation pass (tiles are often re-created during assignment)
     t.is_passable = determinePassability(base_type, slope);
 
     return t;
@@ -90,9 +79,6 @@ Tile Tile::createSpecial(BaseTileType special_type) {
         t.is_passable = false; 
     }
     
-    t.display_cell = determineDisplay(t.base_type, t.height_val, t.slope_val, t.aspect_val, 
-                                     t.distance_to_land, 0.0f, t.animation_offset, t.wave_strand_intensity, 
-                                     t.is_marsh_water_patch, t.distance_to_water);
     return t;
 }
 
@@ -47,6 +47,9 @@ enum class BaseTileType {
     FLOWING_GRASS       // Wind-animated grass with directional flow
 };
 
+// Number of BaseTileType values (FLOWING_GRASS must stay last)
+constexpr size_t BASE_TILE_TYPE_COUNT = static_cast<size_t>(BaseTileType::FLOWING_GRASS) + 1;
+
 enum class SlopeAspect { 
     FLAT, NORTH, NORTHEAST, EAST, SOUTHEAST, SOUTH, SOUTHWEST, WEST, NORTHWEST, STEEP_PEAK 
 };
@@ -82,6 +85,14 @@ struct Tile {
                                              float tile_anim_offset, float tile_wave_strand_intensity,
                                              bool is_marsh_water_patch_flag, int tile_dist_to_water);
 
+    // True if the type's display depends on the global animation progress.
+    // For every other type, display_cell is final and can be reused as-is.
+    static bool isAnimated(BaseTileType base_type);
+
+    // Recompute display_cell from this tile's own fields. Tile factories leave display_cell
+    // unset; Map finalises every tile in one batched pass at the end of generation.
+    void updateDisplay(float global_water_animation_progress = 0.0f);
+
     // Factory method for creating tiles
     static Tile create(BaseTileType base_type, float height, float slope, SlopeAspect aspect, 
                        int distance_to_land_val = -1, int distance_to_water_val = -1, 
@@ -20,117 +20,166 @@ TileAssigner::TileAssigner() {
     initializeSystemAssigners();
 }
 
+TileAssigner::~TileAssigner() = default;
+
 void TileAssigner::initializeSystemAssigners() {
-    system_assigners.clear();
-    
-    // Order matters for delegation - first match wins processing
-    system_assigners.push_back(std::make_unique<Systems::Rivers::RiverTileAssigner>());
-    system_assigners.push_back(std::make_unique<Systems::Lakes::LakeTileAssigner>());
-    system_assigners.push_back(std::make_unique<Systems::Mountains::MountainTileAssigner>());
-    system_assigners.push_back(std::make_unique<Systems::Land::LandTileAssigner>());
-    system_assigners.push_back(std::make_unique<Systems::Vegetation::VegetationTileAssigner>()); // NEW!
+    river_assigner = std::make_unique<Systems::Rivers::RiverTileAssigner>();
+    lake_assigner = std::make_unique<Systems::Lakes::LakeTileAssigner>();
+    mountain_assigner = std::make_unique<Systems::Mountains::MountainTileAssigner>();
+    land_assigner = std::make_unique<Systems::Land::LandTileAssigner>();
+    vegetation_assigner = std::make_unique<Systems::Vegetation::VegetationTileAssigner>();
 }
 
 void TileAssigner::process(WorldData& world_data, unsigned int base_world_seed, int step_seed_offset) {
     std::cout << "  Modular Tile Assignment: Starting coordinated tile assignment..." << std::endl;
     
-    // 1. Perform base tile classification (determines what goes where)
-    performBaseTileClassification(world_data, base_world_seed, step_seed_offset);
+    const size_t map_total_size = static_cast<size_t>(world_data.map_width) * world_data.map_height;
+    if (world_data.map_context->getTilesRef().size() < map_total_size) {
+        std::cerr << "  Modular Tile Assignment: Tile storage smaller than map, skipping." << std::endl;
+        return;
+    }
     
-    // 2. Calculate shoreline effects for land tiles
-    calculateShorelineEffects(world_data);
+    // 1. Shoreline distances only depend on the water masks, so they are ready before classification
+    std::vector<int> distance_to_water;
+    calculateShorelineDistances(world_data, distance_to_water);
     
-    // 3. Delegate to system-specific assigners
-    int sub_step_offset = 100; // Ensure unique seeds for each system
-    for (const auto& assigner : system_assigners) {
-        std::cout << "    Delegating to: " << assigner->getName() << std::endl;
-        assigner->process(world_data, base_world_seed, step_seed_offset + sub_step_offset);
-        sub_step_offset += 100;
-    }
+    // 2. Classify every tile once, create mountain tiles in place and collect work lists
+    performFusedClassificationSweep(world_data, distance_to_water, base_world_seed, step_seed_offset);
+    
+    // 3. Delegate list-driven work to the systems that need neighbourhood context or a serial RNG.
+    // Seed offsets match the original delegation order (rivers, lakes, mountains, land, vegetation).
+    std::cout << "    Delegating to: " << river_assigner->getName() << std::endl;
+    river_assigner->assignTiles(world_data, work_lists.river_tiles, base_world_seed, step_seed_offset + 100);
+    
+    std::cout << "    Delegating to: " << lake_assigner->getName() << std::endl;
+    lake_assigner->assignTiles(world_data, work_lists.lake_tiles, base_world_seed, step_seed_offset + 200);
+    
+    std::cout << "    Delegating to: " << land_assigner->getName() << std::endl;
+    land_assigner->assignTiles(world_data, work_lists.land_tiles, work_lists.marsh_tiles,
+                               base_world_seed, step_seed_offset + 400);
+    
+    std::cout << "    Delegating to: " << vegetation_assigner->getName() << std::endl;
+    vegetation_assigner->assignTiles(world_data, work_lists.land_tiles, base_world_seed, step_seed_offset + 500);
+    
+    // Release list memory; the lists are only needed during assignment
+    work_lists = TileWorkLists();
     
     std::cout << "  Modular Tile Assignment: Completed coordinated tile assignment." << std::endl;
 }
 
-void TileAssigner::performBaseTileClassification(WorldData& world_data, unsigned int base_world_seed, int step_seed_offset) {
+void TileAssigner::performFusedClassificationSweep(WorldData& world_data, const std::vector<int>& distance_to_water,
+                                                   unsigned int base_world_seed, int step_seed_offset) {
     unsigned int classification_seed = base_world_seed + static_cast<unsigned int>(step_seed_offset) + 50;
-    std::cout << "    Performing base tile classification..." << std::endl;
+    std::cout << "    Performing fused tile classification sweep..." << std::endl;
     
     FastNoiseLite dry_patch_noise;
     dry_patch_noise.SetNoiseType(FastNoiseLite::NoiseType_OpenSimplex2S);
     dry_patch_noise.SetFrequency(0.03f); 
     dry_patch_noise.SetSeed(static_cast<int>(classification_seed));
 
-    // Classify tiles into basic categories based on height, slope, and special conditions
-    #pragma omp parallel for
-    for (int y = 0; y < world_data.map_height; ++y) {
-        for (int x = 0; x < world_data.map_width; ++x) {
-            size_t index = static_cast<size_t>(y) * world_data.map_width + x;
-            float h = world_data.heightmap_data[index]; 
-            float s = world_data.slope_map[index];
+    std::vector<Tile>& tiles = world_data.map_context->getTilesRef();
+    
+    // Static scheduling hands each thread one contiguous block of rows in thread order,
+    // so concatenating the per-thread lists reproduces row-major scan order
+    std::vector<TileWorkLists> thread_lists(omp_get_max_threads());
+
+    #pragma omp parallel
+    {
+        TileWorkLists& local_lists = thread_lists[omp_get_thread_num()];
+
+        // Classify tiles into basic categories based on height, slope, and special conditions
+        #pragma omp for schedule(static)
+        for (int y = 0; y < world_data.map_height; ++y) {
+            for (int x = 0; x < world_data.map_width; ++x) {
+                size_t index = static_cast<size_t>(y) * world_data.map_width + x;
+                float h = world_data.heightmap_data[index]; 
+                float s = world_data.slope_map[index];
             
-            BaseTileType determined_base_type = BaseTileType::VOID;
+                BaseTileType determined_base_type = BaseTileType::VOID;
             
-            // Priority order: Water > Mountains > Specialized Land > Basic Land
-            if (world_data.is_river_tile[index]) { 
-                determined_base_type = BaseTileType::RIVER_WATER; 
-            } else if (world_data.is_lake_tile[index]) {
-                // Lakes will be further refined by LakeTileAssigner
-                determined_base_type = BaseTileType::LAKE_WATER;
-            } else if (h < Systems::Land::MARSH_MAX_HEIGHT && s < Core::SLOPE_THRESHOLD_GENTLE * 1.3f) { 
-                determined_base_type = BaseTileType::MARSH;
-            } else if (h >= Systems::Mountains::SNOWLINE_MIN_HEIGHT) { 
-                determined_base_type = BaseTileType::MOUNTAIN_PEAK_SNOW;
-            } else if (h >= Core::TERRAIN_MOUNTAIN_HIGH) { 
-                determined_base_type = BaseTileType::MOUNTAIN_UPPER;
-            } else if (h >= Core::TERRAIN_MOUNTAIN_MID) { 
-                determined_base_type = BaseTileType::MOUNTAIN_MID;
-            } else if (h >= Core::TERRAIN_MOUNTAIN_BASE) { 
-                determined_base_type = BaseTileType::MOUNTAIN_LOWER;
-            } else if (h >= Systems::Land::PLATEAU_MIN_HEIGHT && h < Core::TERRAIN_MOUNTAIN_BASE && s <= Systems::Land::PLATEAU_MAX_SLOPE) { 
-                determined_base_type = BaseTileType::PLATEAU_GRASS;
-            } else if (s >= Core::SLOPE_THRESHOLD_STEEP * 1.1f && h > Core::TERRAIN_ROLLING_HILLS_LOW) { 
-                determined_base_type = BaseTileType::CLIFF_FACE;
-            } else if (h >= Systems::Land::MOOR_MIN_HEIGHT && h <= Systems::Land::MOOR_MAX_HEIGHT && 
-                       s <= Systems::Land::MOOR_MAX_SLOPE && s > Core::SLOPE_THRESHOLD_GENTLE * 0.8f) { 
-                determined_base_type = BaseTileType::MOOR;
-            } else if (h >= Core::TERRAIN_STEEP_SLOPES) { 
-                 if (s > Core::SLOPE_THRESHOLD_MODERATE * 1.2f) {  
-                    determined_base_type = BaseTileType::ROCKY_SLOPE;
-                 } else {
-                    determined_base_type = BaseTileType::STEEP_SLOPE; 
-                 }
-            } else if (h >= Core::TERRAIN_ROLLING_HILLS_LOW) { 
-                determined_base_type = BaseTileType::HILLS;
-            } else if (h >= Core::TERRAIN_PLAINS_LOW) {
-                float dry_noise_val = (Generation::Utils::getCylindricalWrappedNoise(dry_patch_noise, 
-                                                                                   static_cast<float>(x), 
-                                                                                   static_cast<float>(y), 
-                                                                                   static_cast<float>(world_data.map_width)) + 1.0f) / 2.0f;
-                if (dry_noise_val > 0.65f && h < Core::TERRAIN_PLAINS_HIGH * 0.7f) { 
-                    determined_base_type = BaseTileType::DRY_PLAINS;
-                } else {
-                    determined_base_type = BaseTileType::PLAINS;
+                // Priority order: Water > Mountains > Specialized Land > Basic Land
+                if (world_data.is_river_tile[index]) { 
+                    determined_base_type = BaseTileType::RIVER_WATER; 
+                } else if (world_data.is_lake_tile[index]) {
+                    // Lakes will be further refined by LakeTileAssigner
+                    determined_base_type = BaseTileType::LAKE_WATER;
+                } else if (h < Systems::Land::MARSH_MAX_HEIGHT && s < Core::SLOPE_THRESHOLD_GENTLE * 1.3f) { 
+                    determined_base_type = BaseTileType::MARSH;
+                } else if (h >= Systems::Mountains::SNOWLINE_MIN_HEIGHT) { 
+                    determined_base_type = BaseTileType::MOUNTAIN_PEAK_SNOW;
+                } else if (h >= Core::TERRAIN_MOUNTAIN_HIGH) { 
+                    determined_base_type = BaseTileType::MOUNTAIN_UPPER;
+                } else if (h >= Core::TERRAIN_MOUNTAIN_MID) { 
+                    determined_base_type = BaseTileType::MOUNTAIN_MID;
+                } else if (h >= Core::TERRAIN_MOUNTAIN_BASE) { 
+                    determined_base_type = BaseTileType::MOUNTAIN_LOWER;
+                } else if (h >= Systems::Land::PLATEAU_MIN_HEIGHT && h < Core::TERRAIN_MOUNTAIN_BASE && s <= Systems::Land::PLATEAU_MAX_SLOPE) { 
+                    determined_base_type = BaseTileType::PLATEAU_GRASS;
+                } else if (s >= Core::SLOPE_THRESHOLD_STEEP * 1.1f && h > Core::TERRAIN_ROLLING_HILLS_LOW) { 
+                    determined_base_type = BaseTileType::CLIFF_FACE;
+                } else if (h >= Systems::Land::MOOR_MIN_HEIGHT && h <= Systems::Land::MOOR_MAX_HEIGHT && 
+                           s <= Systems::Land::MOOR_MAX_SLOPE && s > Core::SLOPE_THRESHOLD_GENTLE * 0.8f) { 
+                    determined_base_type = BaseTileType::MOOR;
+                } else if (h >= Core::TERRAIN_STEEP_SLOPES) { 
+                     if (s > Core::SLOPE_THRESHOLD_MODERATE * 1.2f) {  
+                        determined_base_type = BaseTileType::ROCKY_SLOPE;
+                     } else {
+                        determined_base_type = BaseTileType::STEEP_SLOPE; 
+                     }
+                } else if (h >= Core::TERRAIN_ROLLING_HILLS_LOW) { 
+                    determined_base_type = BaseTileType::HILLS;
+                } else if (h >= Core::TERRAIN_PLAINS_LOW) {
+                    float dry_noise_val = (Generation::Utils::getCylindricalWrappedNoise(dry_patch_noise, 
+                                                                                       static_cast<float>(x), 
+                                                                                       static_cast<float>(y), 
+                                                                                       static_cast<float>(world_data.map_width)) + 1.0f) / 2.0f;
+                    if (dry_noise_val > 0.65f && h < Core::TERRAIN_PLAINS_HIGH * 0.7f) { 
+                        determined_base_type = BaseTileType::DRY_PLAINS;
+                    } else {
+                        determined_base_type = BaseTileType::PLAINS;
+                    }
+                } else if (h >= Core::TERRAIN_VERY_LOW_LAND) { 
+                    determined_base_type = BaseTileType::MEADOW;
+                } else { 
+                    determined_base_type = BaseTileType::MEADOW; 
                 }
-            } else if (h >= Core::TERRAIN_VERY_LOW_LAND) { 
-                determined_base_type = BaseTileType::MEADOW;
-            } else { 
-                determined_base_type = BaseTileType::MEADOW; 
-            }
             
-            // Store the classification in the tile (temporary storage)
-            // Each system assigner will process only tiles of their type
-            if (index < world_data.map_context->getTilesRef().size()) {
-                world_data.map_context->getTilesRef()[index].base_type = determined_base_type;
+                Tile& tile = tiles[index];
+                tile.base_type = determined_base_type;
+                tile.distance_to_water = distance_to_water[index];
+                
+                // Dispatch to the owning system. Lakes follow the water mask rather than the
+                // classification, since the lake assigner also claims river tiles inside lakes.
+                if (world_data.is_lake_tile[index]) {
+                    local_lists.lake_tiles.push_back(index);
+                }
+                if (determined_base_type == BaseTileType::RIVER_WATER) {
+                    local_lists.river_tiles.push_back(index);
+                } else if (Systems::Mountains::MountainTileAssigner::ownsType(determined_base_type)) {
+                    mountain_assigner->assignTile(world_data, index, determined_base_type);
+                } else if (Systems::Land::LandTileAssigner::ownsType(determined_base_type)) {
+                    local_lists.land_tiles.push_back(index);
+                    if (determined_base_type == BaseTileType::MARSH) {
+                        local_lists.marsh_tiles.push_back(index);
+                    }
+                }
             }
         }
     }
+
+    work_lists.clear();
+    for (const TileWorkLists& lists : thread_lists) {
+        work_lists.append(lists);
+    }
+    std::cout << "    Classified tiles: " << work_lists.river_tiles.size() << " river, "
+              << work_lists.lake_tiles.size() << " lake, " << work_lists.land_tiles.size() << " land." << std::endl;
 }
 
-void TileAssigner::calculateShorelineEffects(WorldData& world_data) {
-    std::cout << "    Calculating shoreline effects for land tiles..." << std::endl;
+void TileAssigner::calculateShorelineDistances(WorldData& world_data, std::vector<int>& temp_distance_to_water) {
+    std::cout << "    Calculating shoreline distances for land tiles..." << std::endl;
     
     const size_t map_total_size = static_cast<size_t>(world_data.map_width) * world_data.map_height;
-    std::vector<int> temp_distance_to_water(map_total_size, -1);
+    temp_distance_to_water.assign(map_total_size, -1);
     std::queue<std::pair<std::pair<int,int>, int>> dist_q;
 
     // Find all land tiles adjacent to water
@@ -192,13 +241,6 @@ void TileAssigner::calculateShorelineEffects(WorldData& world_data) {
             }
         }
     }
-
-    // Store distance_to_water in tiles for land system to use
-    for (size_t i = 0; i < map_total_size; ++i) {
-        if (i < world_data.map_context->getTilesRef().size()) {
-            world_data.map_context->getTilesRef()[i].distance_to_water = temp_distance_to_water[i];
-        }
-    }
 }
 
 } // namespace World
\ No newline at end of file
@@ -1,27 +1,46 @@
 // File: EmergentKingdoms/src/World/TileAssigner.h
 #pragma once
 #include "GenerationSteps/IGenerationStep.h"
+#include "TileWorkLists.h"
 #include <memory>
 #include <vector>
 
 namespace World {
 
+namespace Systems {
+    namespace Rivers { class RiverTileAssigner; }
+    namespace Lakes { class LakeTileAssigner; }
+    namespace Mountains { class MountainTileAssigner; }
+    namespace Land { class LandTileAssigner; }
+    namespace Vegetation { class VegetationTileAssigner; }
+}
+
 /**
  * Modular TileAssigner that coordinates system-specific tile assigners
- * Each terrain system (Rivers, Lakes, Mountains, Land) handles its own tiles
+ * Each terrain system (Rivers, Lakes, Mountains, Land) handles its own tiles.
+ * A single fused sweep classifies every tile, creates context-free tiles (mountains)
+ * in place, and builds per-system work lists so no system rescans the full map.
  */
 class TileAssigner : public Generation::IGenerationStep {
 public:
     TileAssigner();
+    ~TileAssigner();
     void process(WorldData& world_data, unsigned int base_world_seed, int step_seed_offset) override;
     std::string getName() const override { return "Modular Tile Assigner Coordinator"; }
 
 private:
     void initializeSystemAssigners();
-    void performBaseTileClassification(WorldData& world_data, unsigned int base_world_seed, int step_seed_offset);
-    void calculateShorelineEffects(WorldData& world_data);
+    void calculateShorelineDistances(WorldData& world_data, std::vector<int>& distance_to_water);
+    void performFusedClassificationSweep(WorldData& world_data, const std::vector<int>& distance_to_water,
+                                         unsigned int base_world_seed, int step_seed_offset);
+    
+    std::unique_ptr<Systems::Rivers::RiverTileAssigner> river_assigner;
+    std::unique_ptr<Systems::Lakes::LakeTileAssigner> lake_assigner;
+    std::unique_ptr<Systems::Mountains::MountainTileAssigner> mountain_assigner;
+    std::unique_ptr<Systems::Land::LandTileAssigner> land_assigner;
+    std::unique_ptr<Systems::Vegetation::VegetationTileAssigner> vegetation_assigner;
     
-    std::vector<std::unique_ptr<Generation::IGenerationStep>> system_assigners;
+    TileWorkLists work_lists;
 };
 
 } // namespace World
\ No newline at end of file
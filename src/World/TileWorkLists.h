@@ -0,0 +1,45 @@
+// File: EmergentKingdoms/src/World/TileWorkLists.h
+#pragma once
+#include <vector>
+#include <cstddef>
+
+namespace World {
+
+/**
+ * Per-system tile index lists produced by the fused classification sweep.
+ * Indices are in row-major scan order, so systems that consume a serial RNG
+ * stream visit tiles in exactly the order a full-map scan would.
+ */
+struct TileWorkLists {
+    std::vector<size_t> river_tiles;  // is_river_tile
+    std::vector<size_t> lake_tiles;   // is_lake_tile (lakes win over rivers when both are set)
+    std::vector<size_t> land_tiles;   // Land-owned base types, including marsh
+    std::vector<size_t> marsh_tiles;  // MARSH only (subset of land_tiles)
+
+    void clear() {
+        river_tiles.clear();
+        lake_tiles.clear();
+        land_tiles.clear();
+        marsh_tiles.clear();
+    }
+
+    // Append another list set; used to merge per-thread lists in thread order
+    void append(const TileWorkLists& other) {
+        river_tiles.insert(river_tiles.end(), other.river_tiles.begin(), other.river_tiles.end());
+        lake_tiles.insert(lake_tiles.end(), other.lake_tiles.begin(), other.lake_tiles.end());
+        land_tiles.insert(land_tiles.end(), other.land_tiles.begin(), other.land_tiles.end());
+        marsh_tiles.insert(marsh_tiles.end(), other.marsh_tiles.begin(), other.marsh_tiles.end());
+    }
+};
+
+// Full-map scan used when a system assigner runs standalone
+template <typename Predicate>
+std::vector<size_t> collectTileIndices(size_t tile_count, Predicate predicate) {
+    std::vector<size_t> indices;
+    for (size_t index = 0; index < tile_count; ++index) {
+        if (predicate(index)) indices.push_back(index);
+    }
+    return indices;
+}
+
+} // namespace World
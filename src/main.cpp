@@ -1,15 +1,52 @@
 // File: EmergentKingdoms/src/main.cpp
 #include "Core/Game.h"
+#include "Core/BaseConfig.h"
+#include "Core/PatternGenerationBenchmark.h"
 #include <iostream> // For std::ios_base::sync_with_stdio
+#include <string>
+#include <cstdlib>
 
 // No need for windows.h or SetConsoleOutputCP for SFML graphical output
 
-int main() {
+int main(int argc, char* argv[]) {
     // std::ios_base::sync_with_stdio(false); // Less relevant for SFML output performance
     // std::cin.tie(NULL); // Less relevant
 
+    // --benchmark [seed] [--headless]: replay the scripted camera path on a fixed-seed world and
+    // print the report; --headless renders through the software renderer without a window
+    if (argc > 1 && std::string(argv[1]) == "--benchmark") {
+        unsigned int seed = Core::BENCHMARK_WORLD_SEED;
+        bool headless = false;
+        for (int arg = 2; arg < argc; ++arg) {
+            if (std::string(argv[arg]) == "--headless") {
+                headless = true;
+            } else {
+                seed = static_cast<unsigned int>(std::strtoul(argv[arg], nullptr, 10));
+            }
+        }
+        Core::Game benchmarkGame(seed, headless);
+        benchmarkGame.runBenchmark();
+        return 0;
+    }
+
+    // --benchmark-patterns [seed]: time multi-tile object pattern generation (no window needed)
+    if (argc > 1 && std::string(argv[1]) == "--benchmark-patterns") {
+        unsigned int seed = (argc > 2) ? static_cast<unsigned int>(std::strtoul(argv[2], nullptr, 10))
+                                       : Core::BENCHMARK_WORLD_SEED;
+        Core::runPatternGenerationBenchmark(seed, std::cout);
+        return 0;
+    }
+
+    // --screenshot <file.png> [seed]: render the map centre through the software renderer (no window)
+    if (argc > 2 && std::string(argv[1]) == "--screenshot") {
+        unsigned int seed = (argc > 3) ? static_cast<unsigned int>(std::strtoul(argv[3], nullptr, 10))
+                                       : Core::BENCHMARK_WORLD_SEED;
+        Core::Game screenshotGame(seed, true);
+        return screenshotGame.runScreenshot(argv[2]) ? 0 : 1;
+    }
+
     Core::Game emergentKingdomsGame;
     emergentKingdomsGame.run(); // This now contains the SFML game loop
 
     return 0;
-}
\ No newline at end of file
+}